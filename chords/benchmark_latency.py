@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""
+Latency benchmark for the Glove80 config: how long from pressing a key or
+chord until the last character of its output reaches the host.
+
+Builds latency histograms for
+  - plain keys, replayed from key_log.sqlite through the combo model in
+    replay_key_log.py (keys on combo positions wait for the combo engine),
+  - LAYER_CHORD combos, grouped by their timeout-ms,
+  - CHMAC macros, from their bindings and tap-ms/wait-ms,
+  - cycle string bursts, every press of every list as measured by the
+    harness of simulate_cycle_strings.py,
+on top of the key debounce and one HID report per host poll interval.
+
+The numbers come from a model of the firmware, not a capture, so compare them
+against each other: save a baseline, change the config or a behavior, and
+compare.
+
+    python3 chords/benchmark_latency.py --save-baseline /tmp/latency.json
+    python3 chords/benchmark_latency.py --baseline /tmp/latency.json
+    python3 chords/benchmark_latency.py --transport ble
+
+With --baseline it exits non-zero when a category's p95 got worse by more
+than --tolerance-ms.
+"""
+
+import argparse
+import json
+import random
+import re
+import statistics
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+import replay_key_log
+import simulate_cycle_strings
+
+# --- Configuration ---
+DEBOUNCE_PRESS_MS = 5       # ZMK default debounce-press-ms
+REPORT_INTERVAL_MS = {"usb": 1.0, "ble": 7.5}
+CHORD_SPREAD_MS = 25        # How far apart the keys of a chord typically land
+
+
+def percentile(values: list[float], fraction: float) -> float:
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))] if ordered else 0.0
+
+
+class Bench:
+    def __init__(self, args):
+        self.rng = random.Random(args.seed)
+        self.interval = REPORT_INTERVAL_MS[args.transport]
+        self.debounce = args.debounce_ms
+        self.spread = args.spread_ms
+
+    def host(self, reports_before_last: int) -> float:
+        """Debounce, then the reports up to the one carrying the last character."""
+        return self.debounce + reports_before_last * self.interval + self.rng.uniform(0, self.interval)
+
+
+def plain_keys(bench: Bench, defines, combos, hold_ms: float) -> list[float]:
+    presses = replay_key_log.load_presses(replay_key_log.KEY_LOG_FILE, defines,
+                                          replay_key_log.DEFAULT_MACRO_GAP_MS)
+    model = replay_key_log.ComboModel(combos, hold_ms)
+    for press in presses:
+        model.press(press, "")
+    model.finish()
+    return [delay + bench.host(0) for delay in model.delays]
+
+
+def chord_wait(combo, combos, spread: float) -> float:
+    """Time from the chord's last key until the combo engine fires it."""
+    if any(other is not combo and combo.positions < other.positions for other in combos):
+        # A larger combo could still complete, so it waits for the timeout
+        return max(0.0, combo.timeout_ms - spread)
+    return 0.0
+
+
+def layer_chords(bench: Bench, combos, samples: int) -> dict[int, list[float]]:
+    by_timeout = defaultdict(list)
+    for combo in combos:
+        for _ in range(samples):
+            spread = bench.rng.uniform(0, min(bench.spread, combo.timeout_ms))
+            by_timeout[combo.timeout_ms].append(chord_wait(combo, combos, spread) + bench.host(0))
+    return by_timeout
+
+
+def parse_macros(paths) -> dict[str, tuple[int, int, int]]:
+    """CHMAC name -> (key taps, tap-ms, wait-ms)."""
+    macros = {}
+    for path in paths:
+        if not path.exists():
+            continue
+        content = replay_key_log.strip_comments(replay_key_log.read_file(path))
+        define = re.search(r"#define CHMAC\(.*?tap-ms = <(\d+)>;.*?wait-ms = <(\d+)>;", content, re.DOTALL)
+        if not define:
+            continue
+        tap_ms, wait_ms = int(define.group(1)), int(define.group(2))
+        for name, bindings in re.findall(r"^\s*CHMAC\((\w+),\s*(.*?)\)\s*$", content, re.MULTILINE):
+            macros[name] = (bindings.count("&kp"), tap_ms, wait_ms)
+    return macros
+
+
+def chord_macros(bench: Bench, combos, samples: int) -> list[float]:
+    macros = parse_macros(replay_key_log.COMBO_FILES)
+    latencies = []
+    for combo in combos:
+        name = combo.binding.lstrip("&")
+        if name not in macros:
+            continue
+        taps, tap_ms, wait_ms = macros[name]
+        for _ in range(samples):
+            spread = bench.rng.uniform(0, min(bench.spread, combo.timeout_ms))
+            # The last tap is pressed after every earlier tap and wait, and
+            # each transition needs its own report
+            macro_ms = (taps - 1) * (tap_ms + wait_ms)
+            reports = 2 * (taps - 1)
+            latencies.append(chord_wait(combo, combos, spread)
+                             + max(macro_ms + bench.host(0), bench.host(reports)))
+    return latencies
+
+
+def cycle_strings(bench: Bench, layout: str, emit: str, combo_ms: float) -> list[float]:
+    latencies = []
+    for cost in simulate_cycle_strings.press_costs(layout, emit):
+        # Every transition reaches the host as a report; the last character is
+        # the space, whose release report comes after it
+        if cost.reports:
+            latencies.append(combo_ms + bench.host(cost.reports - 2))
+    return latencies
+
+
+def summarize(latencies: list[float]) -> dict:
+    return {
+        "n": len(latencies),
+        "mean": round(statistics.fmean(latencies), 2) if latencies else 0.0,
+        "p50": round(percentile(latencies, 0.5), 2),
+        "p95": round(percentile(latencies, 0.95), 2),
+        "max": round(max(latencies, default=0.0), 2),
+    }
+
+
+def print_histogram(name: str, latencies: list[float], bucket_ms: float, width: int = 40):
+    stats = summarize(latencies)
+    print(f"{name}: n={stats['n']} mean={stats['mean']:.1f} ms p50={stats['p50']:.1f} ms "
+          f"p95={stats['p95']:.1f} ms max={stats['max']:.1f} ms")
+    if not latencies:
+        return
+    buckets = defaultdict(int)
+    for latency in latencies:
+        buckets[int(latency // bucket_ms)] += 1
+    peak = max(buckets.values())
+    for bucket in range(min(buckets), max(buckets) + 1):
+        count = buckets.get(bucket, 0)
+        bar = "#" * round(count / peak * width)
+        print(f"  {bucket * bucket_ms:6.0f}-{(bucket + 1) * bucket_ms:<4.0f} ms {count:7d} {bar}")
+
+
+def compare(results: dict, baseline_path: Path, tolerance_ms: float) -> bool:
+    try:
+        baseline = json.loads(baseline_path.read_text(encoding="utf-8"))
+    except (IOError, ValueError) as e:
+        print(f"Error reading baseline {baseline_path}: {e}", file=sys.stderr)
+        sys.exit(1)
+    regressed = False
+    print(f"\nAgainst baseline {baseline_path}:")
+    for name, stats in results.items():
+        if name not in baseline:
+            print(f"  {name}: new")
+            continue
+        delta50 = stats["p50"] - baseline[name]["p50"]
+        delta95 = stats["p95"] - baseline[name]["p95"]
+        flag = ""
+        if delta95 > tolerance_ms:
+            flag = "  REGRESSED"
+            regressed = True
+        print(f"  {name}: p50 {delta50:+.1f} ms, p95 {delta95:+.1f} ms{flag}")
+    return regressed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Model key, chord, macro and cycle string latency.")
+    parser.add_argument("--transport", choices=sorted(REPORT_INTERVAL_MS), default="usb")
+    parser.add_argument("--debounce-ms", type=float, default=DEBOUNCE_PRESS_MS)
+    parser.add_argument("--spread-ms", type=float, default=CHORD_SPREAD_MS,
+                        help=f"Typical spread of a chord's key presses (default: {CHORD_SPREAD_MS})")
+    parser.add_argument("--hold-ms", type=float, default=100, help="Assumed key hold time for the replay")
+    parser.add_argument("--layout", choices=simulate_cycle_strings.LAYOUTS, default="SE")
+    parser.add_argument("--emit", choices=simulate_cycle_strings.EMIT_MODES, default="events")
+    parser.add_argument("--cycle-combo-ms", type=float, default=0,
+                        help="Combo wait before a cycle string press fires (default: 0)")
+    parser.add_argument("--samples", type=int, default=200, help="Samples per chord")
+    parser.add_argument("--bucket-ms", type=float, default=5)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--save-baseline", type=Path, metavar="FILE")
+    parser.add_argument("--baseline", type=Path, metavar="FILE")
+    parser.add_argument("--tolerance-ms", type=float, default=1.0)
+    args = parser.parse_args()
+
+    bench = Bench(args)
+    defines = replay_key_log.parse_defines(replay_key_log.KEYMAP_FILE)
+    alpha_combos = replay_key_log.parse_combos(replay_key_log.COMBO_FILES, defines, "ALPHA")
+    # A combo active on several layers counts once
+    all_combos = list({combo.name: combo for layer in ("ALPHA", "ENGLISH_CHORDS", "SWEDISH_CHORDS")
+                       for combo in replay_key_log.parse_combos(replay_key_log.COMBO_FILES, defines,
+                                                                layer)}.values())
+
+    categories = {"plain keys": plain_keys(bench, defines, alpha_combos, args.hold_ms)}
+    for timeout, latencies in sorted(layer_chords(bench, alpha_combos, args.samples).items()):
+        categories[f"LAYER_CHORD timeout-ms={timeout}"] = latencies
+    categories["CHMAC macros"] = chord_macros(bench, all_combos, args.samples)
+    categories[f"cycle strings ({args.emit})"] = cycle_strings(bench, args.layout, args.emit,
+                                                               args.cycle_combo_ms)
+
+    print(f"Transport {args.transport} ({bench.interval} ms per report), debounce {args.debounce_ms} ms\n")
+    for name, latencies in categories.items():
+        print_histogram(name, latencies, args.bucket_ms)
+        print()
+
+    results = {name: summarize(latencies) for name, latencies in categories.items()}
+    if args.save_baseline:
+        args.save_baseline.write_text(json.dumps(results, indent=2) + "\n", encoding="utf-8")
+        print(f"Saved baseline to {args.save_baseline}")
+    if args.baseline and compare(results, args.baseline, args.tolerance_ms):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
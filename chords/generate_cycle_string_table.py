@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+Compiles the word lists in custom_behavior/cycle_string_lists.h into a
+pre-encoded table for the cycle string behavior.
+
+Strings are stored as Latin-1 text, one byte per character, so the firmware
+never decodes UTF-8. Which key types a character is decided by the host layout
+table picked in Kconfig (custom_behavior/cycle_string_layout.h), so the same
+table serves every layout. Each list is front-coded: a variant only stores the
+suffix after what it shares with the previous variant, which is also exactly
+what a cycle step has to type. All lists share one byte blob indexed by 16-bit
+offsets. See custom_behavior/cycle_string_dict.h.
+
+Also emits where each list's usage counters start, for the adaptive variant
+order (CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE), and a checksum of the table
+so counts saved against an older table are discarded. The sizes other modules
+need go in a header of their own, so they do not pull in the table data.
+
+Run from anywhere:
+    python3 chords/generate_cycle_string_table.py
+"""
+
+import re
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+# --- Configuration ---
+BEHAVIOR_DIR = Path(__file__).parent.parent / "custom_behavior"
+INPUT_LISTS_FILE = BEHAVIOR_DIR / "cycle_string_lists.h"
+OUTPUT_TABLE_FILE = BEHAVIOR_DIR / "cycle_string_table.h"
+OUTPUT_LIMITS_FILE = BEHAVIOR_DIR / "cycle_string_limits.h"
+
+# Lengths and characters are stored as uint8_t in the generated table, list
+# offsets into the blob as uint16_t
+MAX_STRING_CHARS = 255
+MAX_LIST_STRINGS = 255
+MAX_BLOB_OFFSET = 0xFFFF
+
+
+def parse_cycle_lists(path: Path) -> list[list[str]]:
+    """Extracts the string lists from the all_cycle_lists initializer."""
+    try:
+        content = path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {path}: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    list_pattern = re.compile(
+        r"\.strings\s*=\s*\(const char \*\[\]\)\{(.*?)\}\s*,\s*\.len\s*=\s*(\d+)",
+        re.DOTALL,
+    )
+    string_pattern = re.compile(r'"((?:[^"\\]|\\.)*)"')
+
+    lists = []
+    for index, match in enumerate(list_pattern.finditer(content)):
+        strings = string_pattern.findall(match.group(1))
+        declared_len = int(match.group(2))
+        if len(strings) != declared_len:
+            print(f"Error: list {index} declares .len = {declared_len} but has {len(strings)} strings.",
+                  file=sys.stderr)
+            sys.exit(1)
+        lists.append(strings)
+
+    if not lists:
+        print(f"Error: No cycle lists found in {path}", file=sys.stderr)
+        sys.exit(1)
+    return lists
+
+
+def encode_string(text: str, list_index: int, controls: str = "\t\n") -> list[int]:
+    """Encodes a string as Latin-1 character codes, keeping only the given
+    control characters (the host layout table has keys for Tab, Enter and
+    Backspace)."""
+    chars = []
+    for char in text:
+        code = ord(char)
+        if code > 0xFF or (code < 0x20 and char not in controls) or 0x7F <= code < 0xA0:
+            print(f"Warning: Character '{char}' in '{text}' (list {list_index}) is not printable Latin-1. "
+                  f"Skipping character.", file=sys.stderr)
+            continue
+        chars.append(code)
+    return chars
+
+
+def shared_prefix_len(a: list, b: list) -> int:
+    """Number of leading characters two encoded strings have in common."""
+    length = 0
+    for key_a, key_b in zip(a, b):
+        if key_a != key_b:
+            break
+        length += 1
+    return length
+
+
+def c_comment_text(text: str) -> str:
+    """Keeps generated comments from terminating early or spilling onto the
+    next line."""
+    text = text.replace("*/", "* /")
+    return text.replace("\b", "\\b").replace("\t", "\\t").replace("\n", "\\n")
+
+
+def encode_lists(lists: list[list[str]]) -> list[list[list[int]]]:
+    """Encodes every string of every list, validating sizes."""
+    encoded_lists = []
+    for list_index, strings in enumerate(lists):
+        if not strings or len(strings) > MAX_LIST_STRINGS:
+            print(f"Error: list {list_index} has {len(strings)} strings, expected 1..{MAX_LIST_STRINGS}.",
+                  file=sys.stderr)
+            sys.exit(1)
+        encoded = []
+        for text in strings:
+            chars = encode_string(text, list_index)
+            if not chars or len(chars) > MAX_STRING_CHARS:
+                print(f"Error: '{text}' (list {list_index}) encodes to {len(chars)} characters, "
+                      f"expected 1..{MAX_STRING_CHARS}.", file=sys.stderr)
+                sys.exit(1)
+            encoded.append(chars)
+        encoded_lists.append(encoded)
+    return encoded_lists
+
+
+def front_code_list(encoded: list) -> list[tuple[int, list[int]]]:
+    """Front-codes a list: (shared prefix, suffix characters) per variant."""
+    entries = []
+    for variant, chars in enumerate(encoded):
+        prefix = shared_prefix_len(encoded[variant - 1], chars) if variant > 0 else 0
+        entries.append((prefix, chars[prefix:]))
+    return entries
+
+
+def c_char(code: int) -> str:
+    """C literal for one Latin-1 character code."""
+    char = chr(code)
+    if char.isascii() and char.isprintable() and char not in "'\\":
+        return f"'{char}'"
+    return f"0x{code:02X}"
+
+
+def build_table(lists: list[list[str]]) -> dict:
+    """Encodes the lists into the table data: the blob, each list's (offset,
+    count, wrap prefix), the usage counter bases and the table checksum. Also
+    keeps each list's front-coded entries for the generated comments."""
+    encoded_lists = encode_lists(lists)
+    refs = []
+    entries = []
+    blob = bytearray()
+    for list_index, encoded in enumerate(encoded_lists):
+        if len(blob) > MAX_BLOB_OFFSET:
+            print(f"Error: list {list_index} starts at blob offset {len(blob)}, "
+                  f"past the 16-bit limit of {MAX_BLOB_OFFSET}.", file=sys.stderr)
+            sys.exit(1)
+        # Cycling wraps around, so the first variant follows the last one
+        wrap_prefix = shared_prefix_len(encoded[-1], encoded[0])
+        refs.append((len(blob), len(encoded), wrap_prefix))
+        entries.append(front_code_list(encoded))
+        for prefix, suffix in entries[-1]:
+            blob += bytes([prefix, len(suffix)] + suffix)
+
+    # Only lists with more than one variant have anything to reorder, so only
+    # they get usage counters
+    usage_base = [0]
+    for encoded in encoded_lists:
+        usage_base.append(usage_base[-1] + (len(encoded) if len(encoded) > 1 else 0))
+    return {
+        "blob": bytes(blob),
+        "refs": refs,
+        "entries": entries,
+        "usage_base": usage_base,
+        "max_variants": max(len(encoded) for encoded in encoded_lists),
+        "crc": zlib.crc32(bytes(blob) + b"".join(struct.pack("<HBB", *ref) for ref in refs)),
+    }
+
+
+def generate_limits(lists: list[list[str]], table: dict) -> str:
+    return "\n".join([
+        "/*",
+        f" * Generated from {INPUT_LISTS_FILE.name} by chords/{Path(__file__).name}",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        f" * Sizes of the tables in {OUTPUT_TABLE_FILE.name}, without their data.",
+        " */",
+        "",
+        "#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H",
+        "#define CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H",
+        "",
+        f"#define CYCLE_STRING_LISTS {len(lists)}",
+        f"#define CYCLE_STRING_MAX_VARIANTS {table['max_variants']}",
+        f"#define CYCLE_STRING_USAGE_SLOTS {table['usage_base'][-1]}",
+        f"#define CYCLE_STRING_TABLE_CRC 0x{table['crc']:08X}u",
+        "",
+        "#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H",
+        "",
+    ])
+
+
+def generate_table(lists: list[list[str]], table: dict) -> tuple[str, int]:
+    lines = [
+        "/*",
+        f" * Generated from {INPUT_LISTS_FILE.name} by chords/{Path(__file__).name}",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        " * Front-coded cycle lists in one blob, see cycle_string_dict.h for the format.",
+        " */",
+        "",
+        "#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H",
+        "#define CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "#include <zephyr/sys/util.h>",
+        "",
+        "#include \"cycle_string_dict.h\"",
+        f"#include \"{OUTPUT_LIMITS_FILE.name}\"",
+        "",
+    ]
+
+    # All lists back to back in one blob, located through 16-bit offsets
+    lines.append("static const uint8_t cycle_string_blob[] = {")
+    for list_index, (strings, entries) in enumerate(zip(lists, table["entries"])):
+        lines.append(f"    // {list_index}")
+        for text, (prefix, suffix) in zip(strings, entries):
+            packed = "".join(f" {c_char(code)}," for code in suffix)
+            lines.append(f"    {prefix}, {len(suffix)},{packed} // {c_comment_text(text)}")
+    lines += ["};", ""]
+
+    lines.append("static const struct cycle_string_list all_cycle_lists[] = {")
+    for list_index, (list_offset, count, wrap_prefix) in enumerate(table["refs"]):
+        lines.append(f"    {{{list_offset}, {count}, {wrap_prefix}}}, // {list_index}")
+    lines += [
+        "};",
+        "",
+        "static const size_t all_cycle_lists_len = ARRAY_SIZE(all_cycle_lists);",
+        "",
+    ]
+
+    usage_base = table["usage_base"]
+    lines += [
+        "#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)",
+        "// First usage counter of each list, plus one past the last list",
+        "static const uint16_t cycle_string_usage_base[] = {",
+    ]
+    for start in range(0, len(usage_base), 12):
+        lines.append("    " + " ".join(f"{base}," for base in usage_base[start:start + 12]))
+    lines += [
+        "};",
+        "#endif",
+        "",
+        "#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H",
+        "",
+    ]
+    data_bytes = len(table["blob"]) + len(table["refs"]) * 4 + len(usage_base) * 2
+    return "\n".join(lines), data_bytes
+
+
+def main():
+    print(f"Reading cycle lists: {INPUT_LISTS_FILE}")
+    lists = parse_cycle_lists(INPUT_LISTS_FILE)
+    print(f"Loaded {len(lists)} lists with {sum(len(l) for l in lists)} strings.")
+
+    table = build_table(lists)
+    output, data_bytes = generate_table(lists, table)
+    try:
+        OUTPUT_TABLE_FILE.write_text(output, encoding="utf-8")
+        OUTPUT_LIMITS_FILE.write_text(generate_limits(lists, table), encoding="utf-8")
+    except IOError as e:
+        print(f"Error writing {OUTPUT_TABLE_FILE}: {e}", file=sys.stderr)
+        sys.exit(1)
+    print(f"Successfully created '{OUTPUT_TABLE_FILE}' ({data_bytes} bytes of table data)")
+    print(f"Successfully created '{OUTPUT_LIMITS_FILE}'")
+
+
+if __name__ == "__main__":
+    main()
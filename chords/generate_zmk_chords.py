@@ -1,15 +1,43 @@
 #!/usr/bin/env python3
+import argparse
+import itertools
 import json
 import os
 import re
 import string
 from pathlib import Path
-from collections import defaultdict
+from collections import Counter, defaultdict
+
+from generate_cycle_string_table import (MAX_BLOB_OFFSET, MAX_STRING_CHARS, c_char, c_comment_text,
+                                         encode_string)
 
 # === Configuration ===
 INPUT_CHORDS_FILE = "chords/jocke_chords.json" # Use your chord file
 OUTPUT_CHORDS_KEYMAP_FILE = Path("config/generated_chords.keymap") # New output file
+# Strings typed by the &type_str behavior, indexed by its parameter
+OUTPUT_TYPE_STRING_TABLE_FILE = Path("custom_behavior/type_string_table.h")
+# Perfect hash of the chords for the chord engine (CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+OUTPUT_CHORD_ENGINE_TABLE_FILE = Path("custom_behavior/chord_engine_table.h")
+# Its sizes alone, for the modules that do not need the tables themselves
+OUTPUT_CHORD_ENGINE_LIMITS_FILE = Path("custom_behavior/chord_engine_limits.h")
 KEYMAP_FILE = Path("config/glove80.keymap")
+# Typed words, dumped from key_log.sqlite by chords/dump_corpus.py; orders the
+# chord engine's candidates by how often their words come up
+CORPUS_FILE = Path("chords/my_corpus.txt")
+# Hand-written combos, counted with the generated ones to size the combo engine
+COMBOS_KEYMAP_FILE = Path("config/chords.keymap")
+# Gets the exact combo limits written into it
+CONF_FILE = Path("config/glove80.conf")
+# Layer of chords that do not list their own "layers"
+DEFAULT_CHORD_LAYER = "ALPHA"
+
+# Must match custom_behavior/chord_engine_dict.h
+CHORD_MASK_WORDS = 3
+CHORD_NO_LAYER = 0xFF
+CHORD_EXTENDS = 1 << 0
+# Chords per hash bucket on average; smaller buckets find seeds faster
+CHORD_BUCKET_SIZE = 4
+MAX_BUCKET_SEED = 0xFFFF
 
 # === ZMK Key Mapping (Add DUP) ===
 ZMK_KEYCODE_MAP = {
@@ -39,47 +67,421 @@ ZMK_KEYCODE_MAP = {
 # Keys that represent modifiers or layers, not standard key presses
 NON_OUTPUT_KEYS = {'LSHFT', 'RSHFT', 'LCTRL', 'RCTRL', 'LALT', 'RALT', 'LGUI', 'RGUI', 'LSFT', 'RSFT'}
 
-def create_macro_bindings(text):
-    """Create ZMK macro bindings for the given text, handling shifts."""
+def chord_output_text(item):
+    """The string a chord types: its first output, plus a space unless exact."""
+    output_val = item.get("output")
+    text = output_val[0] if isinstance(output_val, list) else output_val
     if not text:
-        return "", "" # Return empty strings for base and shifted
-
-    base_bindings = []
-    shifted_bindings = []
-    needs_shifted_macro = False
-    first_char_processed = False
-
-    # Handle leading backspace
-    if text.startswith('\b'):
-        base_bindings.append("&kp BSPC")
-        shifted_bindings.append("&kp BSPC")
-        text = text[1:]
-
-    for char in text:
-        is_first_char = not first_char_processed
-        first_char_processed = True
-
-        if char.islower() and char in ZMK_KEYCODE_MAP:
-            zmk_code = ZMK_KEYCODE_MAP[char]
-            base_bindings.append(f"&kp {zmk_code}")
-            shifted_bindings.append(f"&kp LS({zmk_code})")
-            if is_first_char:
-                needs_shifted_macro = True # Need shift version if first char is lowercase
-        elif char.isupper() and char.lower() in ZMK_KEYCODE_MAP:
-            zmk_code = ZMK_KEYCODE_MAP[char.lower()]
-            base_bindings.append(f"&kp LS({zmk_code})")
-            shifted_bindings.append(f"&kp LS({zmk_code})") # Shifted uppercase is still shifted uppercase
-        elif char in ZMK_KEYCODE_MAP:
-            zmk_code = ZMK_KEYCODE_MAP[char]
-            base_bindings.append(f"&kp {zmk_code}")
-            # How to handle shifted symbols? Depends on layout. Assume base for now.
-            # You might need a more complex mapping for shifted symbols.
-            shifted_bindings.append(f"&kp {zmk_code}")
+        return None
+    return text if item.get("exact", False) else text + " "
+
+
+def build_type_strings(strings):
+    """Packs the chord strings into one blob in the cycle list format (see
+    custom_behavior/cycle_string_dict.h), one single-variant list each, so the
+    cycle string emitter types them. Returns the blob and each string's
+    (offset, length)."""
+    blob = bytearray()
+    refs = []
+    for index, text in enumerate(strings):
+        # Leading backspaces are typed through the layout table like any
+        # other character
+        chars = encode_string(text, index, controls="\b\t\n")
+        if not chars or len(chars) > MAX_STRING_CHARS or len(blob) > MAX_BLOB_OFFSET:
+            print(f"Error: '{text}' encodes to {len(chars)} characters at blob offset {len(blob)}, "
+                  f"expected 1..{MAX_STRING_CHARS} below {MAX_BLOB_OFFSET}.")
+            exit(1)
+        refs.append((len(blob), len(chars)))
+        blob += bytes([0, len(chars)] + chars)
+    return bytes(blob), refs
+
+
+def generate_type_string_table(strings):
+    """Type string table header. Returns the header and its data size."""
+    blob, refs = build_type_strings(strings)
+    lines = [
+        "/*",
+        f" * Generated from {Path(INPUT_CHORDS_FILE).name} by chords/{Path(__file__).name}",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        " * Strings typed by the type string behavior, each a single-variant list in",
+        " * the cycle list format, see cycle_string_dict.h.",
+        " */",
+        "",
+        "#ifndef CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H",
+        "#define CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "#include <zephyr/sys/util.h>",
+        "",
+        "#include \"cycle_string_dict.h\"",
+        "",
+        "static const uint8_t type_string_blob[] = {",
+    ]
+    for index, (text, (offset, length)) in enumerate(zip(strings, refs)):
+        packed = "".join(f" {c_char(code)}," for code in blob[offset + 2:offset + 2 + length])
+        lines.append(f"    0, {length},{packed} // {index}: {c_comment_text(text).rstrip()}")
+    if not refs:
+        lines.append("    0, 0,") # Keeps the array non-empty
+    lines += ["};", "", "static const struct cycle_string_list type_strings[] = {"]
+    for index, (offset, length) in enumerate(refs):
+        # A single variant wraps around to itself
+        lines.append(f"    {{{offset}, 1, {length}}}, // {index}")
+    lines += [
+        "};",
+        "",
+        "static const size_t type_strings_len = ARRAY_SIZE(type_strings);",
+        "",
+        "#endif // CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H",
+        "",
+    ]
+    return "\n".join(lines), len(blob) + len(refs) * 4
+
+
+def parse_keymap_defines(keymap_path):
+    """Name -> number, from the layer and key position #defines in the keymap."""
+    try:
+        content = keymap_path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {keymap_path}: {e}")
+        exit(1)
+    return {name: int(number) for name, number in re.findall(r"^#define (\w+) (\d+)$", content, re.MULTILINE)}
+
+
+def macro_arguments(text, start):
+    """The top-level comma separated arguments of the macro call whose opening
+    parenthesis is at text[start]."""
+    arguments = []
+    depth = 0
+    current = ""
+    for char in text[start + 1:]:
+        if char == "(":
+            depth += 1
+        elif char == ")":
+            if depth == 0:
+                break
+            depth -= 1
+        elif char == "," and depth == 0:
+            arguments.append(current.strip())
+            current = ""
+            continue
+        current += char
+    arguments.append(current.strip())
+    return arguments
+
+
+def parse_keymap_combos(keymap_path, defines):
+    """Name, key positions and layer numbers of each combo in a hand-written
+    keymap, in file order: LAYER_CHORD and CYCLE_COMBO calls and plain
+    key-positions properties, comments and macro definitions left out. A
+    plain property has no name or layers read; its layers are None, for all."""
+    try:
+        content = keymap_path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {keymap_path}: {e}")
+        exit(1)
+    content = re.sub(r"/\*.*?\*/", "", content, flags=re.DOTALL)
+    content = re.sub(r"//[^\n]*", "", content)
+    content = re.sub(r"^#define(?:[^\n]*\\\n)*[^\n]*", "", content, flags=re.MULTILINE)
+
+    # Arguments holding the key positions and the layers, per macro
+    macro_arguments_index = {"LAYER_CHORD": (2, 3), "CYCLE_COMBO": (1, 4)}
+    found = []
+    for match in re.finditer(r"\b(LAYER_CHORD|CYCLE_COMBO)\(|\bkey-positions\s*=\s*<([^>]*)>", content):
+        if match.group(1):
+            arguments = macro_arguments(content, match.end() - 1)
+            positions_index, layers_index = macro_arguments_index[match.group(1)]
+            found.append((arguments[0], arguments[positions_index], arguments[layers_index]))
+        else:
+            found.append((f"combo {len(found) + 1}", match.group(2), None))
+
+    def numbers(text, what):
+        result = []
+        for token in text.split():
+            number = int(token) if token.isdigit() else defines.get(token)
+            if number is None:
+                print(f"Warning: Unknown {what} '{token}' in {keymap_path}. Not counted.")
+                continue
+            result.append(number)
+        return result
+
+    return [(name, numbers(positions, "key position"), None if layers is None else numbers(layers, "layer"))
+            for name, positions, layers in found]
+
+
+def chord_engine_enabled(conf_path):
+    """Whether the board config turns the chord engine on."""
+    try:
+        content = conf_path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {conf_path}: {e}")
+        exit(1)
+    return re.search(r"^CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE=y\s*$", content, re.MULTILINE) is not None
+
+
+def combo_overlaps(engine_chords, combos):
+    """Engine chords sharing a key position with a hand-written combo on one
+    of the combo's layers, as (word, combo name, shared positions). The engine
+    holds back presses of its chord keys until the chord resolves, so such a
+    combo sees its keys late and misses its timeout."""
+    overlaps = []
+    for positions, layer, _, word in engine_chords:
+        for name, combo_positions, combo_layers in combos:
+            if combo_layers is not None and layer not in combo_layers:
+                continue
+            shared = sorted(set(positions) & set(combo_positions))
+            if shared:
+                overlaps.append((word, name, shared))
+    return overlaps
+
+
+def write_combo_limits(conf_path, combos):
+    """Sets the combo engine's limits in the board config to what the combos
+    need: ZMK sizes its lookup by them, a row per key position as wide as
+    CONFIG_ZMK_COMBO_MAX_COMBOS_PER_KEY."""
+    per_position = defaultdict(int)
+    for positions in combos:
+        for position in set(positions):
+            per_position[position] += 1
+    limits = {
+        "CONFIG_ZMK_COMBO_MAX_COMBOS_PER_KEY": max(per_position.values(), default=1),
+        "CONFIG_ZMK_COMBO_MAX_KEYS_PER_COMBO": max((len(positions) for positions in combos), default=1),
+    }
+    try:
+        content = conf_path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {conf_path}: {e}")
+        exit(1)
+    for name, value in limits.items():
+        content, count = re.subn(rf"^{name}=\d+$", f"{name}={value}", content, flags=re.MULTILINE)
+        if count == 0:
+            content += f"{name}={value}\n"
+    conf_path.write_text(content, encoding="utf-8")
+    return limits
+
+
+def load_word_counts(corpus_path):
+    """Occurrences of each lowercase word in the corpus, empty without one."""
+    try:
+        text = corpus_path.read_text(encoding="utf-8").lower()
+    except IOError:
+        print(f"Warning: No corpus at {corpus_path}, chord candidates stay in table order.")
+        return Counter()
+    return Counter(re.findall(r"\b[a-z\u00e4\u00f6\u00e5']+\b", text))
+
+
+def chord_mask(positions):
+    """Key positions as the chord engine's mask words."""
+    words = [0] * CHORD_MASK_WORDS
+    for position in positions:
+        if position >= CHORD_MASK_WORDS * 32:
+            print(f"Error: key position {position} does not fit a {CHORD_MASK_WORDS * 32}-bit chord mask.")
+            exit(1)
+        words[position // 32] |= 1 << (position % 32)
+    return tuple(words)
+
+
+def rotl32(value, bits):
+    return ((value << bits) | (value >> (32 - bits))) & 0xFFFFFFFF
+
+
+def chord_hash(mask, layer, seed):
+    """chord_engine_hash() in custom_behavior/chord_engine_dict.h: MurmurHash3
+    (x86, 32-bit) of the mask words and then the layer."""
+    h = seed
+    for block in (*mask, layer):
+        k = (block * 0xCC9E2D51) & 0xFFFFFFFF
+        k = (rotl32(k, 15) * 0x1B873593) & 0xFFFFFFFF
+        h = rotl32(h ^ k, 13)
+        h = (h * 5 + 0xE6546B64) & 0xFFFFFFFF
+    h ^= (CHORD_MASK_WORDS + 1) * 4
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    return h ^ (h >> 16)
+
+
+def build_perfect_hash(keys):
+    """Hash and displace: finds a seed per bucket so that every (mask, layer)
+    key gets a slot of its own. Returns the seeds and the key of each slot."""
+    slot_count = max(len(keys), 1)
+    bucket_count = max((len(keys) + CHORD_BUCKET_SIZE - 1) // CHORD_BUCKET_SIZE, 1)
+    buckets = defaultdict(list)
+    for key in keys:
+        buckets[chord_hash(*key, 0) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * slot_count
+    # Biggest buckets first, while most slots are still free
+    for bucket, bucket_keys in sorted(buckets.items(), key=lambda item: -len(item[1])):
+        for seed in range(1, MAX_BUCKET_SEED + 1):
+            placed = [chord_hash(*key, seed) % slot_count for key in bucket_keys]
+            if len(set(placed)) == len(placed) and all(slots[slot] is None for slot in placed):
+                break
         else:
-            print(f"Warning: Unknown character '{char}' in text '{text}' for macro generation.")
+            print(f"Error: no seed places the {len(bucket_keys)} chords of hash bucket {bucket}.")
+            exit(1)
+        seeds[bucket] = seed
+        for slot, key in zip(placed, bucket_keys):
+            slots[slot] = key
+    return seeds, slots
+
+
+def build_chord_engine(chords, word_counts):
+    """Chord engine tables from (positions, layer, string index, name) tuples:
+    the perfect hash of the chords and their candidate index."""
+    words = {}
+    for positions, layer, string, name in chords:
+        key = (chord_mask(positions), layer)
+        if key in words:
+            print(f"Warning: chord for '{name}' repeats the keys of '{words[key][1]}' on layer {layer}. Skipping.")
+            continue
+        words[key] = (string, name)
+
+    # A chord inside a longer one on its layer waits for more keys
+    extended = set()
+    for positions, layer, _, _ in chords:
+        for size in range(1, len(positions)):
+            for subset in itertools.combinations(positions, size):
+                if (chord_mask(subset), layer) in words:
+                    extended.add((chord_mask(subset), layer))
+    seeds, slots = build_perfect_hash(sorted(words))
+
+    # Candidate index per layer: the slots of the layer's chords on each key
+    # position, in compressed sparse rows, so a scan never sees another
+    # layer's chords. Most typed words first, as the engine stops at the first
+    # chord that can still follow.
+    chord_slots = [slot for slot, key in enumerate(slots) if key is not None]
+    chord_slots.sort(key=lambda slot: -word_counts[words[slots[slot]][1].lower()])
+    rows = defaultdict(list)
+    for slot in chord_slots:
+        mask, layer = slots[slot]
+        for position in range(CHORD_MASK_WORDS * 32):
+            if mask[position // 32] & (1 << (position % 32)):
+                rows[(layer, position)].append(slot)
+    positions = max((position for _, position in rows), default=-1) + 1
+    # A layer that never matches keeps the table non-empty without chords
+    layers = sorted({layer for _, layer in words}) or [CHORD_NO_LAYER]
+    offsets = [0]
+    candidates = []
+    for layer in layers:
+        for position in range(positions):
+            candidates += rows[(layer, position)]
+            offsets.append(len(candidates))
+    if len(candidates) > 0xFFFF:
+        print(f"Error: {len(candidates)} chord candidates do not fit 16-bit offsets.")
+        exit(1)
+
+    # Every key position that is part of a chord, per layer
+    keys_masks = {layer: [0] * CHORD_MASK_WORDS for layer in layers}
+    for mask, layer in words:
+        keys_masks[layer] = [a | b for a, b in zip(keys_masks[layer], mask)]
+    max_keys = max((len(positions) for positions, _, _, _ in chords), default=1)
+    return {
+        "words": words,
+        "extended": extended,
+        "seeds": seeds,
+        "slots": slots,
+        "rows": rows,
+        "layers": layers,
+        "positions": positions,
+        "offsets": offsets,
+        "candidates": candidates,
+        "keys_masks": keys_masks,
+        "max_keys": max_keys,
+    }
+
+
+def generate_chord_engine_limits(engine):
+    """Header with only the sizes of the chord engine tables."""
+    return "\n".join([
+        "/*",
+        f" * Generated from {Path(INPUT_CHORDS_FILE).name} by chords/{Path(__file__).name}",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        f" * Sizes of the tables in {OUTPUT_CHORD_ENGINE_TABLE_FILE.name}, without their data.",
+        " */",
+        "",
+        "#ifndef CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H",
+        "#define CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H",
+        "",
+        "// Most keys in one chord",
+        f"#define CHORD_ENGINE_MAX_KEYS {engine['max_keys']}",
+        "",
+        "// Key positions up to the last one in a chord",
+        f"#define CHORD_ENGINE_POSITIONS {engine['positions']}",
+        "",
+        "// Layers with chords",
+        f"#define CHORD_ENGINE_LAYERS {len(engine['layers'])}",
+        "",
+        "#endif // CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H",
+        "",
+    ])
+
+
+def generate_chord_engine_table(engine):
+    """Chord engine header from build_chord_engine's tables. Returns the header
+    and its data size."""
+    words, extended, seeds, slots = engine["words"], engine["extended"], engine["seeds"], engine["slots"]
+    rows, layers, positions, offsets, candidates = (engine["rows"], engine["layers"], engine["positions"],
+                                                    engine["offsets"], engine["candidates"])
+    keys_masks = engine["keys_masks"]
+
+    lines = [
+        "/*",
+        f" * Generated from {Path(INPUT_CHORDS_FILE).name} by chords/{Path(__file__).name}",
+        " * DO NOT EDIT MANUALLY",
+        " *",
+        " * Perfect hash of the word chords and their candidate index per layer and",
+        " * key position, see chord_engine_dict.h for the format.",
+        " */",
+        "",
+        "#ifndef CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H",
+        "#define CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#include \"chord_engine_dict.h\"",
+        f"#include \"{OUTPUT_CHORD_ENGINE_LIMITS_FILE.name}\"",
+        "",
+        "static const struct chord_engine_layer chord_engine_layers[CHORD_ENGINE_LAYERS] = {",
+    ]
+    for layer in layers:
+        mask_words = ", ".join(f"0x{word:08X}" for word in keys_masks[layer])
+        layer_text = "CHORD_ENGINE_NO_LAYER" if layer == CHORD_NO_LAYER else str(layer)
+        lines.append(f"    {{{{{mask_words}}}, {layer_text}}},")
+    lines += ["};", "", "static const uint16_t chord_engine_seeds[] = {"]
+    for start in range(0, len(seeds), 12):
+        lines.append("    " + " ".join(f"{seed}," for seed in seeds[start:start + 12]))
+    lines += ["};", "", "static const struct chord_engine_entry chord_engine_entries[] = {"]
+    for key in slots:
+        if key is None:
+            lines.append("    {{0}, CHORD_ENGINE_NO_LAYER, 0, 0},")
+            continue
+        mask, layer = key
+        string, comment = words[key]
+        mask_words = ", ".join(f"0x{word:08X}" for word in mask)
+        flags_text = "CHORD_ENGINE_EXTENDS" if key in extended else "0"
+        lines.append(f"    {{{{{mask_words}}}, {layer}, {flags_text}, {string}}}, // {c_comment_text(comment)}")
+    lines += ["};", "", "static const uint16_t chord_engine_candidate_offsets[CHORD_ENGINE_LAYERS * CHORD_ENGINE_POSITIONS + 1] = {"]
+    for start in range(0, len(offsets), 12):
+        lines.append("    " + " ".join(f"{offset}," for offset in offsets[start:start + 12]))
+    lines += ["};", "", "static const uint16_t chord_engine_candidates[] = {"]
+    for layer in layers:
+        for position in range(positions):
+            if rows[(layer, position)]:
+                slots_text = " ".join(f"{slot}," for slot in rows[(layer, position)])
+                lines.append(f"    {slots_text} // Layer {layer}, {position}")
+    if not candidates:
+        lines.append("    0, // Keeps the array non-empty")
+    lines += ["};", "", "#endif // CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H", ""]
+    data_bytes = (len(layers) * (CHORD_MASK_WORDS * 4 + 4) + len(seeds) * 2
+                  + len(slots) * (CHORD_MASK_WORDS * 4 + 4) + len(offsets) * 2 + len(candidates) * 2)
+    return "\n".join(lines), data_bytes
 
-    # Only return shifted bindings if the first character required a shift
-    return " ".join(base_bindings), " ".join(shifted_bindings) if needs_shifted_macro else None
 
 _used_zmk_names = {}
 def generate_zmk_name(base_name, prefix="m"):
@@ -106,8 +508,31 @@ def generate_zmk_name(base_name, prefix="m"):
     # ZMK identifiers have length limits (e.g., 31 for labels)
     return name[:31]
 
+def key_position(key, word, keymap_defines):
+    """Key position of a chord key, from the K<name> #define of its ZMK
+    keycode name in the keymap: 'a' is KA, ',' KCOMMA and Dup KDUP."""
+    zmk_keycode = ZMK_KEYCODE_MAP.get(key)
+    if not zmk_keycode:
+        print(f"Error: No ZMK keycode mapping for '{key}' in the chord for '{word}'.")
+        exit(1)
+    position = keymap_defines.get(f"K{zmk_keycode}")
+    if position is None:
+        print(f"Error: No '#define K{zmk_keycode}' position in {KEYMAP_FILE} for '{key}' "
+              f"in the chord for '{word}'.")
+        exit(1)
+    if position >= CHORD_MASK_WORDS * 32:
+        print(f"Error: K{zmk_keycode} in {KEYMAP_FILE} is position {position}, past the "
+              f"{CHORD_MASK_WORDS * 32} a chord mask holds ('{key}' in the chord for '{word}').")
+        exit(1)
+    return position
+
+
 # === Main Processing ===
-def main():
+def load_chords():
+    """Reads the chord file. Returns the chord engine's (positions, layer
+    number, string index, word) tuples, the type strings in index order, the
+    LAYER_CHORD combo definitions with the key positions of each, and the
+    keymap's #defines."""
     # Load the input JSON
     try:
         with open(INPUT_CHORDS_FILE, 'r') as f:
@@ -119,69 +544,92 @@ def main():
         print(f"Error: Could not decode JSON from '{INPUT_CHORDS_FILE}'.")
         exit(1)
 
-    # --- Hardcoded Key Positions (Based on User Input & Glove80 Defaults) ---
-    # Mapping from ZMK Keycode Name (e.g., 'A', 'B', 'N1') to Position Number
-    # UPDATED based on provided colemak_dh_lookup
-    key_name_to_pos_num = {
-        # Left Hand
-        'Q': 23, 'W': 24, 'F': 25, 'P': 26, 'B': 27,
-        'A': 35, 'R': 36, 'S': 37, 'T': 38, 'G': 39,
-        'Z': 47, 'X': 48, 'C': 49, 'D': 50, 'V': 51,
-        # Right Hand
-        'J': 28, 'L': 29, 'U': 30, 'Y': 31, 'SEMI': 32, # ';' maps to SEMI
-        'M': 40, 'N': 41, 'E': 42, 'I': 43, 'O': 44,
-        'K': 45, 'H': 59, 'COMMA': 60, 'DOT': 61, 'FSLH': 62, # ',' maps to COMMA, '.' to DOT, '/' to FSLH
-        # Add any missing keys from your ZMK_KEYCODE_MAP if they are used in combos
-        # e.g., 'N1': ?, 'N2': ?, ..., 'SPACE': ?, 'RET': ?, 'TAB': ?, 'ESC': ?, 'BSPC': ?
-    }
+    keymap_defines = parse_keymap_defines(KEYMAP_FILE)
 
-    # Manually define Shift and Dup positions (Update these numbers!)
-    # CRITICAL: Find the position number for your main Shift key (e.g., Left Shift)
-    # Check your #define POS_... lines or count in layer_Base
-    # Verify this position based on your Colemak layout/preferences!
-    shift_pos_num = 46 # POS_LH_C6R5 (Default Glove80 Left Shift) - VERIFY THIS!
-    # CRITICAL: Find the position number where you bound '&key_repeat_behavior'
-    # Verify this position based on your Colemak layout/preferences!
-    dup_pos_num = 63   # POS_RH_C6R5 (Default Glove80 K_PP / Right Thumb) - VERIFY THIS!
-
-    # Add DUP to the map using its manual position
-    if dup_pos_num is not None:
-        key_name_to_pos_num['DUP'] = dup_pos_num
-        print(f"Using DUP position: {dup_pos_num}")
-    else:
-        print("Warning: dup_pos_num is not set. 'Dup' key combos will fail.")
+    combos_definitions = []
+    combo_positions = [] # Key positions of each generated combo
+    engine_chords = [] # (positions, layer number, string index, word)
+    strings = []      # Type string table, in index order
+    string_index = {} # String -> index, so chords typing the same word share it
 
-    if shift_pos_num is None:
-         print("Error: shift_pos_num is not set. Shifted combos cannot be generated.")
-         # exit(1) # Optional: exit if shift is critical
-    else:
-         print(f"Using Shift position: {shift_pos_num}")
-         # Add Shift itself to the map if needed for some reason (usually not)
-         # key_name_to_pos_num['LSHFT'] = shift_pos_num
+    if "chords" in jocke_data and isinstance(jocke_data["chords"], list):
+        _used_zmk_names.clear()
+        for item in jocke_data["chords"]:
+            if not isinstance(item, dict): continue
+            combo_keys = item.get("combo", [])
+            output_val = item.get("output")
+            behavior = item.get("behavior")
+            if not combo_keys or (output_val is None and behavior is None): continue
 
-    print(f"Using hardcoded map with {len(key_name_to_pos_num)} keys.")
-    # --- End of Hardcoded Positions ---
+            if behavior:
+                print(f"Warning: Behavior '{behavior}' found, direct binding not yet implemented. Skipping combo for {behavior}.")
+                continue
+
+            base_name_src = output_val[0] if isinstance(output_val, list) else output_val
+            output_text = chord_output_text(item)
+            if not output_text: continue
+            base_zmk_name = generate_zmk_name(base_name_src, prefix="c")
+            layers = item.get("layers", [DEFAULT_CHORD_LAYER])
+            unknown_layers = [layer for layer in layers if layer not in keymap_defines]
+            if unknown_layers:
+                print(f"Warning: Unknown layers {unknown_layers} for '{base_name_src}' in {KEYMAP_FILE}. Skipping combo.")
+                continue
+
+            # Prepare Key Positions
+            key_positions = [str(key_position(key, base_name_src, keymap_defines)) for key in combo_keys]
+
+            if output_text not in string_index:
+                string_index[output_text] = len(strings)
+                strings.append(output_text)
+            chord_arg_name = base_zmk_name.replace("c_", "", 1) # Name for the LAYER_CHORD macro argument
+            combo_comment = f"// Combo for word: {base_name_src} (Chord: {''.join(sorted(k.lower() for k in combo_keys if k.lower() in ZMK_KEYCODE_MAP))})"
+            combo_positions.append([int(position) for position in key_positions])
+            combos_definitions.append(f"""
+        {combo_comment}
+        LAYER_CHORD({chord_arg_name}, &type_str {string_index[output_text]}, {" ".join(sorted(key_positions, key=int))}, {" ".join(layers)})""") # Remove < >
+            for layer in layers:
+                engine_chords.append(([int(position) for position in key_positions], keymap_defines[layer],
+                                      string_index[output_text], base_name_src))
+
+    return engine_chords, strings, combos_definitions, combo_positions, keymap_defines
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate word chords from the chord file.")
+    parser.add_argument("--combos", action="store_true",
+                        help="Also bind every chord in a zmk,combos node, for builds without the chord engine")
+    args = parser.parse_args()
+
+    engine_chords, strings, combos_definitions, combo_positions, keymap_defines = load_chords()
+
+    keymap_combos = parse_keymap_combos(COMBOS_KEYMAP_FILE, keymap_defines)
+    overlaps = combo_overlaps(engine_chords, keymap_combos)
+    if overlaps and chord_engine_enabled(CONF_FILE):
+        for word, name, shared in overlaps:
+            print(f"Error: The chord for '{word}' shares key position{'s' * (len(shared) > 1)} "
+                  f"{' '.join(map(str, shared))} "
+                  f"with {name} in {COMBOS_KEYMAP_FILE}.")
+        print(f"With CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE=y in {CONF_FILE} those combos only see their keys "
+              f"after the engine lets them go, and miss their timeout. Move the chords or the combos.")
+        exit(1)
+    elif overlaps:
+        print(f"Note: {len(overlaps)} chord/combo pairs in {COMBOS_KEYMAP_FILE} share key positions; "
+              f"they stop the generator once CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE=y is set in {CONF_FILE}.")
 
-    # --- Prepare the output content ---
     # Create the header with helper macros
     output_content = f"""
 /*
- * Generated ZMK Chords & Macros from {INPUT_CHORDS_FILE}
+ * Generated ZMK Chords from {INPUT_CHORDS_FILE}
  * Automatically included by glove80.keymap
  * DO NOT EDIT MANUALLY
+ *
+ * Chords type the strings in custom_behavior/type_string_table.h, generated
+ * alongside this file. The chord engine (CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+ * resolves them from custom_behavior/chord_engine_table.h; with --combos
+ * every chord also gets a combo binding the type string behavior.
  */
-
-#define str(s) #s
-
-#define WORD_MACRO(name, keys) \\
-    name: name {{ \\
-        compatible = "zmk,behavior-macro"; \\
-        #binding-cells = <0>; \\
-        wait-ms = <1>; \\
-        tap-ms = <1>; \\
-        bindings = <keys>, <&kp SPACE>; \\
-    }};
-
+"""
+    if args.combos:
+        output_content += f"""
 #define LAYER_CHORD(name, keypress, keypos, lays) \\
   combo_##name: combo_##name {{ \\
     timeout-ms = <60>; \\
@@ -190,140 +638,66 @@ def main():
     layers = <lays>; \\
   }};
 
-#define CHORD(name, keypress, keypos) \\
-  LAYER_CHORD(name, keypress, keypos, LAYER_Base)
-
 / {{
-    macros {{
-"""
-    macros_definitions = []
-    combos_definitions = []
-
-    # First pass: Generate macro definitions
-    if "chords" in jocke_data and isinstance(jocke_data["chords"], list):
-        # Reset used names for this pass if needed, or manage globally
-        _used_zmk_names.clear() # Clear names before generating macros
-        for item in jocke_data["chords"]:
-            if not isinstance(item, dict): continue
-            output_val = item.get("output")
-            behavior = item.get("behavior")
-            if output_val is None or behavior: continue # Only process output-based macros here
+    behaviors {{
+        type_str: type_str {{
+            compatible = "chord-cycle,behavior-type-string";
+            #binding-cells = <1>;
+        }};
+    }};
 
-            # Determine Base Name
-            base_name_src = output_val[0] if isinstance(output_val, list) else output_val
-            base_zmk_name = generate_zmk_name(base_name_src, prefix="m")
-            exact = item.get("exact", False)
-            add_space = not exact
-
-            # Create Macro Bindings
-            output_text = output_val[0] if isinstance(output_val, list) else output_val
-            base_bindings_str, shifted_bindings_str = create_macro_bindings(output_text)
-
-            if base_bindings_str:
-                macros_definitions.append(f"""
-        // Output: '{output_text}'{' + SPACE' if add_space else ''}
-        WORD_MACRO({base_zmk_name}, {base_bindings_str})""")
-
-            if shifted_bindings_str:
-                shifted_zmk_name = base_zmk_name.replace("m_", "m_S_", 1)
-                macros_definitions.append(f"""
-        // Shifted Output: '{output_text}'{' + SPACE' if add_space else ''}
-        WORD_MACRO({shifted_zmk_name}, {shifted_bindings_str})""")
-
-    # Append macro definitions to output
-    output_content += "\n".join(macros_definitions)
-    output_content += """
-    }; // end of macros
-
-    combos {
+    combos {{
         compatible = "zmk,combos";
 """
-
-    # Second pass: Generate combo definitions
-    if "chords" in jocke_data and isinstance(jocke_data["chords"], list):
-        # Reset used names again to ensure consistency if generate_zmk_name relies on it
-        _used_zmk_names.clear() # Clear names before generating combos/referencing macros
-        for item in jocke_data["chords"]:
-            if not isinstance(item, dict): continue
-            combo_keys = item.get("combo", [])
-            output_val = item.get("output")
-            behavior = item.get("behavior")
-            if not combo_keys or (output_val is None and behavior is None): continue
-
-            # Determine Base Name and Macro Binding
-            base_name_src = ""
-            macro_binding = None
-            shifted_macro_binding = None
-
-            if behavior:
-                print(f"Warning: Behavior '{behavior}' found, direct binding not yet implemented. Skipping combo for {behavior}.")
-                continue
-            elif output_val is not None:
-                base_name_src = output_val[0] if isinstance(output_val, list) else output_val
-                # Regenerate name to match macro pass - IMPORTANT: ensure generate_zmk_name is deterministic
-                # or that the state (_used_zmk_names) is reset correctly between passes.
-                base_zmk_name = generate_zmk_name(base_name_src, prefix="m")
-                macro_binding = f"&{base_zmk_name}"
-                # Check if shifted version exists (based on first char of output)
-                output_text = output_val[0] if isinstance(output_val, list) else output_val
-                _, shifted_bindings_str = create_macro_bindings(output_text)
-                if shifted_bindings_str:
-                    # Need the shifted name again
-                    shifted_zmk_name = base_zmk_name.replace("m_", "m_S_", 1)
-                    shifted_macro_binding = f"&{shifted_zmk_name}"
-
-            if not macro_binding: continue # Skip if no valid binding (e.g., behavior only)
-
-            # Prepare Key Positions
-            key_positions = []
-            valid_combo = True
-            for key in combo_keys:
-                zmk_keycode = ZMK_KEYCODE_MAP.get(key)
-                if not zmk_keycode:
-                    print(f"Warning: No ZMK keycode mapping for '{key}' in combo for '{base_name_src}'. Skipping combo.")
-                    valid_combo = False; break
-                pos_num = key_name_to_pos_num.get(zmk_keycode)
-                if pos_num is None:
-                    print(f"Warning: Could not find position for ZMK keycode '{zmk_keycode}' (from '{key}') in combo for '{base_name_src}'. Skipping combo.")
-                    valid_combo = False; break
-                key_positions.append(str(pos_num))
-
-            if valid_combo:
-                # Derive combo name from base ZMK name used for the macro
-                combo_zmk_name = base_zmk_name.replace("m_", "c_", 1)
-                chord_arg_name = combo_zmk_name.replace("c_", "", 1) # Name for the CHORD macro argument
-                combo_comment = f"// Combo for word: {base_name_src} (Chord: {''.join(sorted(k.lower() for k in combo_keys if k.lower() in ZMK_KEYCODE_MAP))})"
-                combos_definitions.append(f"""
-        {combo_comment}
-        CHORD({chord_arg_name}, {macro_binding}, {" ".join(sorted(key_positions, key=int))})""") # Remove < >
-
-                # Add shifted combo if applicable
-                if shifted_macro_binding and shift_pos_num is not None:
-                    # The CHORD macro itself needs a unique name for the shifted version
-                    shifted_chord_arg_name = f"S_{chord_arg_name}"
-                    shifted_key_positions = sorted(key_positions + [str(shift_pos_num)], key=int)
-                    shifted_combo_comment = f"// Shifted combo for word: {base_name_src}"
-                    combos_definitions.append(f"""
-        {shifted_combo_comment}
-        CHORD({shifted_chord_arg_name}, {shifted_macro_binding}, {" ".join(shifted_key_positions)})""") # Remove < >
-
-
-    # Append combo definitions to output
-    output_content += "\n".join(combos_definitions)
-    output_content += """
+        # Append combo definitions to output
+        # At boot ZMK files every combo under each of its key positions, in
+        # lists ordered by key count and then node order. Emitted in that
+        # order, the file reads the way ZMK builds the lists; the boot-time
+        # insertion sort still runs, it only has nothing to move.
+        ordered = sorted(zip(combo_positions, combos_definitions), key=lambda combo: len(combo[0]))
+        output_content += "\n".join(definition for _, definition in ordered)
+        output_content += """
     }; // end of combos
 }; // end of /
 """
+    table_content, table_bytes = generate_type_string_table(strings)
+    engine = build_chord_engine(engine_chords, load_word_counts(CORPUS_FILE))
+    engine_content, engine_bytes = generate_chord_engine_table(engine)
 
-    # Save the output file
+    # Save the output files
     try:
         os.makedirs(os.path.dirname(OUTPUT_CHORDS_KEYMAP_FILE), exist_ok=True)
         with open(OUTPUT_CHORDS_KEYMAP_FILE, 'w') as f:
             f.write(output_content)
         print(f"Successfully created '{OUTPUT_CHORDS_KEYMAP_FILE}'")
+        with open(OUTPUT_TYPE_STRING_TABLE_FILE, 'w', encoding='utf-8') as f:
+            f.write(table_content)
+        print(f"Successfully created '{OUTPUT_TYPE_STRING_TABLE_FILE}' "
+              f"({len(strings)} strings, {table_bytes} bytes of table data)")
+        with open(OUTPUT_CHORD_ENGINE_TABLE_FILE, 'w', encoding='utf-8') as f:
+            f.write(engine_content)
+        print(f"Successfully created '{OUTPUT_CHORD_ENGINE_TABLE_FILE}' "
+              f"({len(engine_chords)} chords, {engine_bytes} bytes of table data)")
+        with open(OUTPUT_CHORD_ENGINE_LIMITS_FILE, 'w', encoding='utf-8') as f:
+            f.write(generate_chord_engine_limits(engine))
+        print(f"Successfully created '{OUTPUT_CHORD_ENGINE_LIMITS_FILE}'")
     except IOError as e:
         print(f"Error writing output files: {e}")
         exit(1)
 
+    all_combos = [positions for _, positions, _ in keymap_combos]
+    # Hand-written combos go in the same boot-time order as the generated
+    # ones: by key count, then node order
+    for index, (previous, combo) in enumerate(zip(all_combos, all_combos[1:]), start=2):
+        if len(combo) < len(previous):
+            print(f"Warning: Combo {index} in {COMBOS_KEYMAP_FILE} has fewer keys than the one before it. "
+                  f"ZMK moves it in its lookup at every boot; keep combos sorted by key count.")
+            break
+    if args.combos:
+        all_combos += combo_positions
+    limits = write_combo_limits(CONF_FILE, all_combos)
+    print(f"Set {', '.join(f'{name}={value}' for name, value in limits.items())} in '{CONF_FILE}' "
+          f"({len(all_combos)} combos)")
+
 if __name__ == "__main__":
     main()
@@ -0,0 +1,737 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+// Host harness for the cycle string behavior. The real behavior_cycle_string.c,
+// cycle_string_emit.c and cycle_string_tables.c are built against the
+// stand-ins for Zephyr and ZMK in include/, and every cycle list is pressed
+// through the behavior's driver API. Raised keycode events go through the
+// subscribed listeners like in ZMK's event manager, and whatever bubbles past
+// them reaches a modeled HID report and a host typing from it, so each press is
+// counted and its text checked against the variant it should leave on screen.
+// Then a few checks type around the strings: a sticky Shift pressed before a
+// string has to capitalize it and be used up by it, a key typed with Shift
+// held gets its shifted punctuation rule, and with sentence case a string
+// after a period starts with a capital unless Backspace took the period back.
+//
+// Built and run by chords/simulate_cycle_strings.py, which passes the Kconfig
+// symbols of the layout and emit mode:
+//     cycle_string_harness [--cycles N] [--list N | --presses]
+//                          [--max-events-per-press X] [--max-events-per-word X]
+// --list traces one list, --presses prints the cost of every press on a line
+// of its own instead of the summary, for chords/benchmark_latency.py. Exits 1
+// when a press types the wrong text or an average goes over its limit.
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zmk/behavior.h>
+#include <zmk/endpoints.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/hid.h>
+
+#include "cycle_string_layout.h"
+#include "cycle_string_punctuation.h"
+#include "cycle_string_tables.h"
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_SE)
+#define LAYOUT_NAME "SE"
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US)
+#define LAYOUT_NAME "US"
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US_INTL)
+#define LAYOUT_NAME "US_INTL"
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_DE)
+#define LAYOUT_NAME "DE"
+#endif
+
+// What a press is measured in: keycode events raised, or HID reports sent
+// when the emitter writes the report itself
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_EMIT_HID_DIRECT)
+#define EMIT_NAME "hid"
+#define UNIT "reports"
+#define UNIT_COST(cost) ((cost).reports)
+#else
+#define EMIT_NAME "events"
+#define UNIT "events"
+#define UNIT_COST(cost) ((cost).events)
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+#define SENTENCE_NAME ", sentence case"
+#else
+#define SENTENCE_NAME ""
+#endif
+
+#define MAX_SUBSCRIPTIONS 8
+#define HOST_TEXT_MAX 1024
+#define WORST_PRESSES 5
+#define MAX_REPORTED_FAILURES 10
+
+// What one press cost
+struct cost {
+  unsigned events;         // Keycode events raised
+  unsigned listener_calls; // Listener invocations those events caused
+  unsigned reports;        // HID reports sent to the host
+  unsigned taps;           // Keys the host saw go down
+  unsigned backspaces;
+};
+
+static struct cost cost;
+static int64_t uptime;
+
+int64_t k_uptime_get(void) { return uptime; }
+
+// --- Event manager ---
+
+const struct zmk_event_type zmk_event_zmk_keycode_state_changed = {"zmk_keycode_state_changed"};
+
+struct subscription {
+  const struct zmk_event_type *event;
+  const char *name;
+  const struct zmk_listener *listener;
+};
+
+static struct subscription subscriptions[MAX_SUBSCRIPTIONS];
+static size_t subscriptions_len;
+
+void harness_subscribe(const struct zmk_event_type *event, const char *name,
+                       const struct zmk_listener *listener) {
+  if (subscriptions_len == MAX_SUBSCRIPTIONS) {
+    fprintf(stderr, "Error: more than %d subscriptions\n", MAX_SUBSCRIPTIONS);
+    exit(2);
+  }
+  size_t i = subscriptions_len++;
+  while (i > 0 && strcmp(subscriptions[i - 1].name, name) > 0) {
+    subscriptions[i] = subscriptions[i - 1];
+    --i;
+  }
+  subscriptions[i] = (struct subscription){event, name, listener};
+}
+
+static void hid_listener(const struct zmk_keycode_state_changed *ev);
+
+int raise_zmk_keycode_state_changed(struct zmk_keycode_state_changed data) {
+  struct zmk_keycode_state_changed_event ev = {
+      .header = {.event = &zmk_event_zmk_keycode_state_changed}, .data = data};
+  ++cost.events;
+  for (size_t i = 0; i < subscriptions_len; ++i) {
+    if (subscriptions[i].event != ev.header.event) {
+      continue;
+    }
+    ++cost.listener_calls;
+    if (subscriptions[i].listener->callback(&ev.header) != ZMK_EV_EVENT_BUBBLE) {
+      return 0;
+    }
+  }
+  // Past every listener the event reaches ZMK's HID listener
+  hid_listener(&ev.data);
+  return 0;
+}
+
+struct zmk_keycode_state_changed *as_zmk_keycode_state_changed(const zmk_event_t *eh) {
+  if (eh->event != &zmk_event_zmk_keycode_state_changed) {
+    return NULL;
+  }
+  return &((struct zmk_keycode_state_changed_event *)eh)->data;
+}
+
+const struct device *zmk_behavior_get_binding(const char *name) {
+  return strcmp(name, harness_device_0.name) == 0 ? &harness_device_0 : NULL;
+}
+
+// --- HID report ---
+
+static uint8_t explicit_counts[8]; // Per modifier bit, as ZMK counts them
+static zmk_mod_flags_t implicit_mods;
+static zmk_mod_flags_t masked_mods;
+static bool keys_down[256]; // In the report
+static bool keys_sent[256]; // In the last report the host got
+
+int zmk_hid_register_mods(zmk_mod_flags_t explicit_modifiers) {
+  for (int i = 0; i < 8; ++i) {
+    if (explicit_modifiers & BIT(i)) {
+      ++explicit_counts[i];
+    }
+  }
+  return 0;
+}
+
+int zmk_hid_unregister_mods(zmk_mod_flags_t explicit_modifiers) {
+  for (int i = 0; i < 8; ++i) {
+    if (explicit_modifiers & BIT(i)) {
+      if (explicit_counts[i] == 0) {
+        return -EINVAL;
+      }
+      --explicit_counts[i];
+    }
+  }
+  return 0;
+}
+
+zmk_mod_flags_t zmk_hid_get_explicit_mods(void) {
+  zmk_mod_flags_t mods = 0;
+  for (int i = 0; i < 8; ++i) {
+    if (explicit_counts[i] != 0) {
+      mods |= BIT(i);
+    }
+  }
+  return mods;
+}
+
+static inline bool is_mod_usage(zmk_key_t key) {
+  return is_mod(HID_USAGE_KEY, key);
+}
+
+int zmk_hid_keyboard_press(zmk_key_t key) {
+  if (is_mod_usage(key)) {
+    return zmk_hid_register_mods(BIT(key - HID_USAGE_KEY_KEYBOARD_LEFTCONTROL));
+  }
+  keys_down[key & 0xFF] = true;
+  return 0;
+}
+
+int zmk_hid_keyboard_release(zmk_key_t key) {
+  if (is_mod_usage(key)) {
+    return zmk_hid_unregister_mods(BIT(key - HID_USAGE_KEY_KEYBOARD_LEFTCONTROL));
+  }
+  keys_down[key & 0xFF] = false;
+  return 0;
+}
+
+int zmk_hid_implicit_modifiers_press(zmk_mod_flags_t implicit_modifiers) {
+  implicit_mods = implicit_modifiers;
+  return 0;
+}
+
+int zmk_hid_implicit_modifiers_release(void) {
+  implicit_mods = 0;
+  return 0;
+}
+
+int zmk_hid_masked_modifiers_set(zmk_mod_flags_t masked_modifiers) {
+  masked_mods = masked_modifiers;
+  return 0;
+}
+
+int zmk_hid_masked_modifiers_clear(void) {
+  masked_mods = 0;
+  return 0;
+}
+
+// As ZMK's hid_listener: the key and its modifiers go into the report, which
+// is sent right away
+static void hid_listener(const struct zmk_keycode_state_changed *ev) {
+  if (ev->state) {
+    zmk_hid_keyboard_press(ev->keycode);
+    zmk_hid_register_mods(ev->explicit_modifiers);
+    zmk_hid_implicit_modifiers_press(ev->implicit_modifiers);
+  } else {
+    zmk_hid_keyboard_release(ev->keycode);
+    zmk_hid_unregister_mods(ev->explicit_modifiers);
+    zmk_hid_implicit_modifiers_release();
+  }
+  zmk_endpoints_send_report(ev->usage_page);
+}
+
+// --- Host ---
+
+// Character the host layout types for a key with or without Shift and AltGr,
+// from the same table the emitter types with
+#define HOST_CHAR BIT(8)
+#define HOST_DEAD BIT(9)
+static uint16_t host_chars[256][2][2];
+
+static uint8_t host_text[HOST_TEXT_MAX]; // Latin-1
+static size_t host_text_len;
+static int host_dead = -1; // Accent of a dead key waiting for the next key
+
+static void host_init(void) {
+  for (int c = 0; c < 256; ++c) {
+    const struct cycle_string_layout_key *key = &cycle_string_layout[c];
+    uint16_t *entry = &host_chars[key->usage][(key->mods & (MOD_LSFT | MOD_RSFT)) != 0]
+                                 [(key->mods & MOD_RALT) != 0];
+    if (key->usage != 0 && *entry == 0) {
+      *entry = c | HOST_CHAR | (key->dead ? HOST_DEAD : 0);
+    }
+  }
+  // Space with Shift held, as after punctuation typed with a held Shift
+  host_chars[HID_USAGE_KEY_KEYBOARD_SPACEBAR][true][false] =
+      host_chars[HID_USAGE_KEY_KEYBOARD_SPACEBAR][false][false];
+}
+
+static void host_append(uint8_t c) {
+  if (host_text_len < HOST_TEXT_MAX) {
+    host_text[host_text_len++] = c;
+  }
+}
+
+// A key went down in a report: type what the host layout makes of it
+static void host_type(uint8_t usage, zmk_mod_flags_t mods) {
+  ++cost.taps;
+  if (usage == HID_USAGE_KEY_KEYBOARD_DELETE_BACKSPACE) {
+    ++cost.backspaces;
+    host_dead = -1;
+    if (host_text_len != 0) {
+      --host_text_len;
+    }
+    return;
+  }
+  uint16_t entry = host_chars[usage][(mods & (MOD_LSFT | MOD_RSFT)) != 0][(mods & MOD_RALT) != 0];
+  if (host_dead >= 0) {
+    // A dead key followed by Space types the accent itself; anything else
+    // would compose, which no cycle string relies on
+    host_append(usage == HID_USAGE_KEY_KEYBOARD_SPACEBAR ? host_dead : '?');
+    host_dead = -1;
+    if (usage == HID_USAGE_KEY_KEYBOARD_SPACEBAR) {
+      return;
+    }
+  }
+  if (!(entry & HOST_CHAR)) {
+    host_append('?');
+  } else if (entry & HOST_DEAD) {
+    host_dead = entry & 0xFF;
+  } else {
+    host_append(entry & 0xFF);
+  }
+}
+
+int zmk_endpoints_send_report(uint16_t usage_page) {
+  ++cost.reports;
+  zmk_mod_flags_t mods = (zmk_hid_get_explicit_mods() & ~masked_mods) | implicit_mods;
+  for (int usage = 0; usage < 256; ++usage) {
+    if (keys_down[usage] && !keys_sent[usage]) {
+      host_type(usage, mods);
+    }
+    keys_sent[usage] = keys_down[usage];
+  }
+  return 0;
+}
+
+static void print_latin1(FILE *out, const uint8_t *text, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    if (text[i] < 0x80) {
+      fputc(text[i], out);
+    } else {
+      fputc(0xC0 | text[i] >> 6, out);
+      fputc(0x80 | (text[i] & 0x3F), out);
+    }
+  }
+}
+
+// --- Presses ---
+
+static bool missing_chars[256]; // In some variant, but not in the host layout
+
+// The text a variant should leave on screen: its characters the layout has a
+// key for, and the space after it
+static size_t expected_text(uint32_t list_index, uint8_t variant, uint8_t *text) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  const struct cycle_string_list *list = &tables->cycle_lists[list_index];
+  struct cycle_string_variant entry = cycle_string_variant_get(tables->cycle_blob, list, variant);
+  size_t len = 0;
+  for (uint8_t pos = 0; pos < cycle_string_variant_len(&entry); ++pos) {
+    uint8_t c = cycle_string_variant_char(tables->cycle_blob, list, variant, pos);
+    if (cycle_string_layout[c].usage == 0) {
+      missing_chars[c] = true;
+    } else if (c == '\b') {
+      len -= len != 0;
+    } else {
+      text[len++] = c;
+    }
+  }
+  text[len++] = ' ';
+  return len;
+}
+
+// Press and release the behavior bound to a list, and return what it cost
+static struct cost press_list(uint32_t list_index) {
+  const struct behavior_driver_api *api = harness_device_0.api;
+  struct zmk_behavior_binding binding = {.behavior_dev = harness_device_0.name,
+                                         .param1 = list_index};
+  struct zmk_behavior_binding_event event = {.timestamp = uptime};
+  memset(&cost, 0, sizeof(cost));
+  api->binding_pressed(&binding, event);
+  uptime += 10;
+  event.timestamp = uptime;
+  api->binding_released(&binding, event);
+  uptime += 10;
+  return cost;
+}
+
+// What run_list prints for each press
+enum output {
+  OUTPUT_SUMMARY, // Nothing, the totals are printed at the end
+  OUTPUT_TRACE,
+  OUTPUT_PRESSES,
+};
+
+struct press_record {
+  unsigned cost;
+  uint32_t list_index;
+  uint8_t variant;
+};
+
+struct totals {
+  unsigned presses;
+  unsigned first_presses;
+  struct cost all;
+  unsigned first_cost;
+  unsigned failures;
+  struct press_record worst[WORST_PRESSES];
+};
+
+static void add_cost(struct cost *sum, const struct cost *press) {
+  sum->events += press->events;
+  sum->listener_calls += press->listener_calls;
+  sum->reports += press->reports;
+  sum->taps += press->taps;
+  sum->backspaces += press->backspaces;
+}
+
+static void record_worst(struct totals *totals, struct press_record record) {
+  int i = WORST_PRESSES;
+  while (i > 0 && totals->worst[i - 1].cost < record.cost) {
+    if (i < WORST_PRESSES) {
+      totals->worst[i] = totals->worst[i - 1];
+    }
+    --i;
+  }
+  if (i < WORST_PRESSES) {
+    totals->worst[i] = record;
+  }
+}
+
+// Cycle through a list, the first press then `cycles` full passes, checking
+// the screen after each press
+static void run_list(struct totals *totals, uint32_t list_index, unsigned cycles,
+                     enum output output) {
+  uint8_t len = cycle_string_tables_get()->cycle_lists[list_index].len;
+  uint8_t expected[HOST_TEXT_MAX];
+  host_text_len = 0;
+  if (output == OUTPUT_TRACE) {
+    printf("List %u: %u variants\n", list_index, len);
+  }
+  for (unsigned step = 0; step <= len * cycles; ++step) {
+    uint8_t variant = step % len;
+    struct cost press = press_list(list_index);
+    size_t expected_len = expected_text(list_index, variant, expected);
+
+    ++totals->presses;
+    add_cost(&totals->all, &press);
+    if (step == 0) {
+      ++totals->first_presses;
+      totals->first_cost += UNIT_COST(press);
+    }
+    record_worst(totals, (struct press_record){UNIT_COST(press), list_index, variant});
+
+    if (output == OUTPUT_PRESSES) {
+      printf("%u %u %u %u %u %u %u\n", list_index, variant, press.events, press.reports,
+             press.listener_calls, press.taps, press.backspaces);
+    } else if (output == OUTPUT_TRACE) {
+      printf("  press %u: variant %u '", step + 1, variant);
+      print_latin1(stdout, host_text, host_text_len);
+      printf("' backspaces=%u taps=%u events=%u reports=%u listener=%u\n", press.backspaces,
+             press.taps, press.events, press.reports, press.listener_calls);
+    }
+    if (host_text_len != expected_len || memcmp(host_text, expected, expected_len) != 0) {
+      if (totals->failures++ < MAX_REPORTED_FAILURES) {
+        fprintf(stderr, "FAIL: list %u variant %u left '", list_index, variant);
+        print_latin1(stderr, host_text, host_text_len);
+        fprintf(stderr, "' on screen, expected '");
+        print_latin1(stderr, expected, expected_len);
+        fprintf(stderr, "'\n");
+      }
+    }
+  }
+}
+
+// --- Checks ---
+
+// As ZMK's sticky key behavior bound to &kp LSHIFT: tapping it registers Shift,
+// and the release of the next key that is not a modifier releases it. Only a
+// keycode event passing its listener does that.
+static bool sticky_shift;
+static zmk_key_t sticky_modified; // Key pressed while Shift was sticky, 0 for none
+
+// A key the user pressed, with the implicit modifiers of e.g. &kp LS(N1)
+static void raise_key(zmk_key_t key, zmk_mod_flags_t implicit_modifiers, bool state) {
+  raise_zmk_keycode_state_changed(
+      (struct zmk_keycode_state_changed){.usage_page = HID_USAGE_KEY,
+                                         .keycode = key,
+                                         .implicit_modifiers = implicit_modifiers,
+                                         .state = state,
+                                         .timestamp = uptime});
+}
+
+static void tap_key(zmk_key_t key, zmk_mod_flags_t implicit_modifiers) {
+  raise_key(key, implicit_modifiers, true);
+  raise_key(key, implicit_modifiers, false);
+}
+
+static int sticky_key_listener(const zmk_event_t *eh) {
+  const struct zmk_keycode_state_changed *ev = as_zmk_keycode_state_changed(eh);
+  if (ev == NULL || !sticky_shift || is_mod(ev->usage_page, ev->keycode)) {
+    return ZMK_EV_EVENT_BUBBLE;
+  }
+  if (ev->state) {
+    if (sticky_modified == 0) {
+      sticky_modified = ev->keycode;
+    }
+  } else if (ev->keycode == sticky_modified) {
+    sticky_shift = false;
+    raise_key(HID_USAGE_KEY_KEYBOARD_LEFTSHIFT, 0, false);
+  }
+  return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(behavior_sticky_key, sticky_key_listener);
+
+// The first list whose first variant is a lower case ASCII word, and that word
+static uint32_t check_word(char *word) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  for (uint32_t list_index = 0; list_index < tables->cycle_lists_len; ++list_index) {
+    uint8_t text[HOST_TEXT_MAX];
+    size_t len = expected_text(list_index, 0, text) - 1; // Without the space
+    bool plain = len != 0;
+    for (size_t i = 0; i < len; ++i) {
+      plain = plain && text[i] < 0x80 && islower(text[i]);
+    }
+    if (plain) {
+      memcpy(word, text, len);
+      word[len] = '\0';
+      return list_index;
+    }
+  }
+  return UINT32_MAX;
+}
+
+// Start a check on an empty screen, with no cycle in progress and in the
+// middle of a sentence
+static void check_start(void) {
+  tap_key(HID_USAGE_KEY_KEYBOARD_A, 0);
+  host_text_len = 0;
+  host_dead = -1;
+}
+
+static bool check_screen(const char *name, const char *expected) {
+  size_t len = strlen(expected);
+  if (host_text_len == len && memcmp(host_text, expected, len) == 0) {
+    return true;
+  }
+  fprintf(stderr, "FAIL: %s left '", name);
+  print_latin1(stderr, host_text, host_text_len);
+  fprintf(stderr, "' on screen, expected '%s'\n", expected);
+  return false;
+}
+
+// A sticky Shift capitalizes the string pressed after it and is used up by
+// it: the key after the string comes out in lower case
+static bool check_sticky_shift(uint32_t list_index, const char *capital) {
+  // Subscribed here, so the measured presses do not pay for it
+  harness_subscribe(&zmk_event_zmk_keycode_state_changed, "behavior_sticky_key",
+                    &zmk_listener_behavior_sticky_key);
+  check_start();
+  sticky_shift = true;
+  sticky_modified = 0;
+  raise_key(HID_USAGE_KEY_KEYBOARD_LEFTSHIFT, 0, true);
+  press_list(list_index);
+  tap_key(HID_USAGE_KEY_KEYBOARD_A, 0);
+  char expected[HOST_TEXT_MAX];
+  snprintf(expected, sizeof(expected), "%s a", capital);
+  return check_screen("sticky Shift, a string, then a", expected);
+}
+
+// A key typed with Shift held by hand between two presses of a string. The
+// Shift is only in the HID report, as a keymap's &kp LSHIFT leaves it, not in
+// the key's event, and the key must still get its shifted punctuation rule.
+static bool check_held_shift(uint32_t list_index, const char *word, const char *capital,
+                             zmk_key_t key) {
+  check_start();
+  press_list(list_index);
+  raise_key(HID_USAGE_KEY_KEYBOARD_LEFTSHIFT, 0, true);
+  tap_key(key, 0);
+  raise_key(HID_USAGE_KEY_KEYBOARD_LEFTSHIFT, 0, false);
+  press_list(list_index);
+
+  uint8_t rule = cycle_string_punctuation_rules[key][true];
+  char shifted = host_chars[key][true][false] & 0xFF;
+  const char *next = word;
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+  if (rule & CYCLE_STRING_RULE_ENDS_SENTENCE) {
+    next = capital;
+  }
+#endif
+  char expected[HOST_TEXT_MAX];
+  if (rule & CYCLE_STRING_RULE_REPLACE) {
+    snprintf(expected, sizeof(expected), "%s%c%s%s ", word, shifted,
+             rule & CYCLE_STRING_RULE_SPACE ? " " : "", next);
+  } else {
+    snprintf(expected, sizeof(expected), "%s %c%s ", word, shifted, next);
+  }
+  char name[64];
+  snprintf(name, sizeof(name), "a string, held Shift and '%c', a string", shifted);
+  return check_screen(name, expected);
+}
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+
+// A period typed after a string replaces its space and ends the sentence, so
+// the next string starts with a capital and the one after it does not
+static bool check_sentence_case(uint32_t list_index, const char *word, const char *capital) {
+  check_start();
+  press_list(list_index);
+  tap_key(HID_USAGE_KEY_KEYBOARD_PERIOD_AND_GREATER_THAN, 0);
+  press_list(list_index);
+  tap_key(HID_USAGE_KEY_KEYBOARD_A, 0);
+  char expected[HOST_TEXT_MAX];
+  snprintf(expected, sizeof(expected), "%s. %s a", word, capital);
+  return check_screen("a string, a period, a string, then a", expected);
+}
+
+// Deleting the period takes the sentence end back with it
+static bool check_sentence_backspace(uint32_t list_index, const char *word) {
+  check_start();
+  press_list(list_index);
+  tap_key(HID_USAGE_KEY_KEYBOARD_PERIOD_AND_GREATER_THAN, 0);
+  tap_key(HID_USAGE_KEY_KEYBOARD_DELETE_BACKSPACE, 0);
+  press_list(list_index);
+  char expected[HOST_TEXT_MAX];
+  snprintf(expected, sizeof(expected), "%s.%s ", word, word);
+  return check_screen("a string, a period, Backspace, a string", expected);
+}
+
+#endif
+
+// Typing around the strings, on top of the per-press text checks
+static bool run_checks(void) {
+  char word[HOST_TEXT_MAX];
+  uint32_t list_index = check_word(word);
+  if (list_index == UINT32_MAX) {
+    return true;
+  }
+  char capital[HOST_TEXT_MAX];
+  strcpy(capital, word);
+  capital[0] = toupper(capital[0]);
+
+  bool passed = true;
+  passed &= check_held_shift(list_index, word, capital, HID_USAGE_KEY_KEYBOARD_1_AND_EXCLAMATION);
+  passed &= check_held_shift(list_index, word, capital,
+                             HID_USAGE_KEY_KEYBOARD_PERIOD_AND_GREATER_THAN);
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+  passed &= check_sentence_case(list_index, word, capital);
+  passed &= check_sentence_backspace(list_index, word);
+#endif
+  // Last, as it subscribes a listener
+  passed &= check_sticky_shift(list_index, capital);
+  return passed;
+}
+
+static void print_summary(const struct totals *totals, double per_press, double per_word) {
+  printf("Layout %s, %s emission%s, %u lists, %u presses\n", LAYOUT_NAME, EMIT_NAME, SENTENCE_NAME,
+         cycle_string_tables_get()->cycle_lists_len, totals->presses);
+  printf("  %-34s%.2f\n", UNIT " per press:", per_press);
+  printf("  %-34s%.2f\n", UNIT " per word (first press):", per_word);
+  printf("  %-34s%.2f\n", "taps per press:", (double)totals->all.taps / totals->presses);
+  printf("  %-34s%.2f\n", "backspaces per press:",
+         (double)totals->all.backspaces / totals->presses);
+  printf("  %-34s%.2f\n", "listener calls per press:",
+         (double)totals->all.listener_calls / totals->presses);
+  printf("  most expensive presses:\n");
+  for (int i = 0; i < WORST_PRESSES && totals->worst[i].cost != 0; ++i) {
+    printf("    list %u variant %u: %u " UNIT "\n", totals->worst[i].list_index,
+           totals->worst[i].variant, totals->worst[i].cost);
+  }
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--cycles N] [--list N | --presses] [--max-events-per-press X] "
+          "[--max-events-per-word X]\n",
+          program);
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  unsigned cycles = 1;
+  long list = -1;
+  double max_per_press = -1;
+  double max_per_word = -1;
+  enum output output = OUTPUT_SUMMARY;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--presses") == 0) {
+      output = OUTPUT_PRESSES;
+      continue;
+    }
+    if (i + 1 == argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "--cycles") == 0) {
+      cycles = strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--list") == 0) {
+      list = strtol(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--max-events-per-press") == 0) {
+      max_per_press = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--max-events-per-word") == 0) {
+      max_per_word = strtod(argv[++i], NULL);
+    } else {
+      usage(argv[0]);
+    }
+  }
+
+  host_init();
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  struct totals totals = {0};
+  if (list >= 0) {
+    if (list >= tables->cycle_lists_len) {
+      fprintf(stderr, "Error: list %ld out of range 0..%u\n", list, tables->cycle_lists_len - 1);
+      return 2;
+    }
+    run_list(&totals, list, cycles, OUTPUT_TRACE);
+    return totals.failures != 0;
+  }
+  for (uint32_t list_index = 0; list_index < tables->cycle_lists_len; ++list_index) {
+    run_list(&totals, list_index, cycles, output);
+  }
+
+  double per_press = (double)UNIT_COST(totals.all) / totals.presses;
+  double per_word = (double)totals.first_cost / totals.first_presses;
+  if (output == OUTPUT_SUMMARY) {
+    print_summary(&totals, per_press, per_word);
+  }
+  // Warnings and failures after the summary, also when both go to one pipe
+  fflush(stdout);
+  uint8_t missing[256];
+  size_t missing_len = 0;
+  for (int c = 0; c < 256; ++c) {
+    if (missing_chars[c]) {
+      missing[missing_len++] = c;
+    }
+  }
+  if (missing_len != 0) {
+    fprintf(stderr, "Warning: layout %s cannot type: ", LAYOUT_NAME);
+    print_latin1(stderr, missing, missing_len);
+    fprintf(stderr, "\n");
+  }
+
+  bool failed = totals.failures != 0;
+  if (failed) {
+    fprintf(stderr, "FAIL: %u presses left the wrong text on screen\n", totals.failures);
+  }
+  if (!run_checks()) {
+    failed = true;
+  }
+  if (max_per_press >= 0 && per_press > max_per_press) {
+    fprintf(stderr, "FAIL: %.2f " UNIT " per press > %g\n", per_press, max_per_press);
+    failed = true;
+  }
+  if (max_per_word >= 0 && per_word > max_per_word) {
+    fprintf(stderr, "FAIL: %.2f " UNIT " per word > %g\n", per_word, max_per_word);
+    failed = true;
+  }
+  return failed;
+}
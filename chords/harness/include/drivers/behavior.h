@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_DRIVERS_BEHAVIOR_H
+#define HARNESS_DRIVERS_BEHAVIOR_H
+
+#include <stdint.h>
+
+#include <zephyr/device.h>
+
+struct zmk_behavior_binding {
+  const char *behavior_dev;
+  uint32_t param1;
+  uint32_t param2;
+};
+
+struct zmk_behavior_binding_event {
+  int layer;
+  uint32_t position;
+  int64_t timestamp;
+};
+
+typedef int (*behavior_keymap_binding_callback_t)(struct zmk_behavior_binding *binding,
+                                                  struct zmk_behavior_binding_event event);
+
+struct behavior_driver_api {
+  behavior_keymap_binding_callback_t binding_pressed;
+  behavior_keymap_binding_callback_t binding_released;
+};
+
+// Defines the instance's device where DEVICE_DT_GET finds it, and runs its
+// init function before main like Zephyr's POST_KERNEL init level
+#define BEHAVIOR_DT_INST_DEFINE(inst, init_fn, deinit_fn, data_ptr, config_ptr, level, prio,     \
+                                api_ptr)                                                         \
+  const struct device UTIL_CAT(harness_device_, inst) = {                                       \
+      .name = "behavior_" #inst, .config = config_ptr, .api = api_ptr, .data = data_ptr};        \
+  __attribute__((constructor)) static void UTIL_CAT(harness_device_init_, inst)(void) {          \
+    init_fn(&UTIL_CAT(harness_device_, inst));                                                  \
+  }
+
+#endif // HARNESS_DRIVERS_BEHAVIOR_H
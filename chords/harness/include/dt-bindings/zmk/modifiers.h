@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_DT_BINDINGS_ZMK_MODIFIERS_H
+#define HARNESS_DT_BINDINGS_ZMK_MODIFIERS_H
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x10
+#define MOD_RSFT 0x20
+#define MOD_RALT 0x40
+#define MOD_RGUI 0x80
+
+#endif // HARNESS_DT_BINDINGS_ZMK_MODIFIERS_H
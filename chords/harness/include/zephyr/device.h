@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZEPHYR_DEVICE_H
+#define HARNESS_ZEPHYR_DEVICE_H
+
+#include <zephyr/sys/util.h>
+
+struct device {
+  const char *name;
+  const void *config;
+  const void *api;
+  void *const data;
+};
+
+// One devicetree instance of the behavior, as in config/glove80.keymap. Its
+// device is harness_device_0, defined by BEHAVIOR_DT_INST_DEFINE.
+#define DT_DRV_INST(inst) inst
+#define DT_NUM_INST_STATUS_OKAY(compat) 1
+#define DT_INST_FOREACH_STATUS_OKAY(fn) fn(0)
+#define DEVICE_DT_GET(node_id) (&UTIL_CAT(harness_device_, node_id))
+#define DEVICE_DT_INST_GET(inst) DEVICE_DT_GET(DT_DRV_INST(inst))
+
+extern const struct device harness_device_0;
+
+#endif // HARNESS_ZEPHYR_DEVICE_H
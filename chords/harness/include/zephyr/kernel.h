@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZEPHYR_KERNEL_H
+#define HARNESS_ZEPHYR_KERNEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+// Time on the harness clock, which only moves when the harness says so
+int64_t k_uptime_get(void);
+
+static inline uint32_t k_cycle_get_32(void) { return (uint32_t)k_uptime_get(); }
+
+static inline unsigned int find_lsb_set(uint32_t op) { return __builtin_ffs(op); }
+
+#endif // HARNESS_ZEPHYR_KERNEL_H
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZEPHYR_SYS_UTIL_H
+#define HARNESS_ZEPHYR_SYS_UTIL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host stand-in for Zephyr's utility macros, only those the behavior sources
+// use
+
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define BIT(n) (1UL << (n))
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define BUILD_ASSERT(expr, ...) _Static_assert(expr, "" __VA_ARGS__)
+
+#define UTIL_PRIMITIVE_CAT(a, b) a##b
+#define UTIL_CAT(a, b) UTIL_PRIMITIVE_CAT(a, b)
+
+// As Zephyr's: 1 for a Kconfig symbol defined to 1, 0 for one not defined at
+// all, usable in #if too
+#define IS_ENABLED(config_macro) Z_IS_ENABLED1(config_macro)
+#define Z_IS_ENABLED1(config_macro) Z_IS_ENABLED2(_XXXX##config_macro)
+#define _XXXX1 _YYYY,
+#define Z_IS_ENABLED2(one_or_two_args) Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...) val
+
+#endif // HARNESS_ZEPHYR_SYS_UTIL_H
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_BEHAVIOR_H
+#define HARNESS_ZMK_BEHAVIOR_H
+
+#include <drivers/behavior.h>
+
+#define ZMK_BEHAVIOR_OPAQUE 0
+#define ZMK_BEHAVIOR_TRANSPARENT 1
+
+const struct device *zmk_behavior_get_binding(const char *name);
+
+#endif // HARNESS_ZMK_BEHAVIOR_H
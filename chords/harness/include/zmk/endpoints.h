@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_ENDPOINTS_H
+#define HARNESS_ZMK_ENDPOINTS_H
+
+#include <stdint.h>
+
+// Sends the keyboard report to the harness's host, which types from it
+int zmk_endpoints_send_report(uint16_t usage_page);
+
+#endif // HARNESS_ZMK_ENDPOINTS_H
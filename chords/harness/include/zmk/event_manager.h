@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_EVENT_MANAGER_H
+#define HARNESS_ZMK_EVENT_MANAGER_H
+
+#include <stdint.h>
+
+// ZMK's event manager as the behaviors see it. The harness dispatches raised
+// events to the subscribed listeners in ZMK's order and counts every call.
+
+struct zmk_event_type {
+  const char *name;
+};
+
+typedef struct {
+  const struct zmk_event_type *event;
+  uint8_t last_listener_index;
+} zmk_event_t;
+
+#define ZMK_EV_EVENT_BUBBLE 0
+#define ZMK_EV_EVENT_HANDLED 1
+#define ZMK_EV_EVENT_CAPTURED 2
+
+typedef int (*zmk_listener_callback_t)(const zmk_event_t *eh);
+
+struct zmk_listener {
+  zmk_listener_callback_t callback;
+};
+
+#define ZMK_EVENT_DECLARE(event_type)                                                              \
+  struct event_type##_event {                                                                      \
+    zmk_event_t header;                                                                            \
+    struct event_type data;                                                                        \
+  };                                                                                               \
+  extern const struct zmk_event_type zmk_event_##event_type;                                       \
+  int raise_##event_type(struct event_type data);                                                  \
+  struct event_type *as_##event_type(const zmk_event_t *eh);                                       \
+  struct event_type##_event copy_raised_##event_type(const struct event_type *ev);
+
+#define ZMK_LISTENER(mod, cb) const struct zmk_listener zmk_listener_##mod = {.callback = cb};
+
+// ZMK keeps subscriptions in a linker section sorted by name; the harness
+// registers them before main and sorts them the same way
+#define ZMK_SUBSCRIPTION(mod, ev_type)                                                             \
+  __attribute__((constructor)) static void harness_subscribe_##mod##_##ev_type(void) {             \
+    harness_subscribe(&zmk_event_##ev_type, #mod, &zmk_listener_##mod);                            \
+  }
+
+void harness_subscribe(const struct zmk_event_type *event, const char *name,
+                       const struct zmk_listener *listener);
+
+int zmk_event_manager_raise_after(zmk_event_t *event, const struct zmk_listener *listener);
+
+#define ZMK_EVENT_RAISE_AFTER(ev, mod)                                                             \
+  zmk_event_manager_raise_after((zmk_event_t *)&ev, &zmk_listener_##mod)
+
+#endif // HARNESS_ZMK_EVENT_MANAGER_H
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_EVENTS_KEYCODE_STATE_CHANGED_H
+#define HARNESS_ZMK_EVENTS_KEYCODE_STATE_CHANGED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zmk/event_manager.h>
+#include <zmk/keys.h>
+
+struct zmk_keycode_state_changed {
+  uint16_t usage_page;
+  uint32_t keycode;
+  uint8_t implicit_modifiers;
+  uint8_t explicit_modifiers;
+  bool state;
+  int64_t timestamp;
+};
+
+ZMK_EVENT_DECLARE(zmk_keycode_state_changed);
+
+#endif // HARNESS_ZMK_EVENTS_KEYCODE_STATE_CHANGED_H
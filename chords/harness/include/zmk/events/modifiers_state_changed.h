@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_EVENTS_MODIFIERS_STATE_CHANGED_H
+#define HARNESS_ZMK_EVENTS_MODIFIERS_STATE_CHANGED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zmk/event_manager.h>
+#include <zmk/keys.h>
+
+struct zmk_modifiers_state_changed {
+  zmk_mod_flags_t modifiers;
+  bool state;
+  int64_t timestamp;
+};
+
+ZMK_EVENT_DECLARE(zmk_modifiers_state_changed);
+
+#endif // HARNESS_ZMK_EVENTS_MODIFIERS_STATE_CHANGED_H
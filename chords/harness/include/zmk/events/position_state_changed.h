@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_EVENTS_POSITION_STATE_CHANGED_H
+#define HARNESS_ZMK_EVENTS_POSITION_STATE_CHANGED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zmk/event_manager.h>
+
+struct zmk_position_state_changed {
+  uint8_t source;
+  uint32_t position;
+  bool state;
+  int64_t timestamp;
+};
+
+ZMK_EVENT_DECLARE(zmk_position_state_changed);
+
+#endif // HARNESS_ZMK_EVENTS_POSITION_STATE_CHANGED_H
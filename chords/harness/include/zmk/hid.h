@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_HID_H
+#define HARNESS_ZMK_HID_H
+
+#include <zmk/keys.h>
+
+// The keyboard report, kept by the harness. Modifier usages pressed as keys
+// count as explicit modifiers, like in ZMK.
+int zmk_hid_keyboard_press(zmk_key_t key);
+int zmk_hid_keyboard_release(zmk_key_t key);
+int zmk_hid_register_mods(zmk_mod_flags_t explicit_modifiers);
+int zmk_hid_unregister_mods(zmk_mod_flags_t explicit_modifiers);
+zmk_mod_flags_t zmk_hid_get_explicit_mods(void);
+int zmk_hid_implicit_modifiers_press(zmk_mod_flags_t implicit_modifiers);
+int zmk_hid_implicit_modifiers_release(void);
+int zmk_hid_masked_modifiers_set(zmk_mod_flags_t masked_modifiers);
+int zmk_hid_masked_modifiers_clear(void);
+
+#endif // HARNESS_ZMK_HID_H
@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_KEYMAP_H
+#define HARNESS_ZMK_KEYMAP_H
+
+#include <stdint.h>
+
+typedef uint8_t zmk_keymap_layer_id_t;
+
+#endif // HARNESS_ZMK_KEYMAP_H
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HARNESS_ZMK_KEYS_H
+#define HARNESS_ZMK_KEYS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <dt-bindings/zmk/hid_usage.h>
+#include <dt-bindings/zmk/modifiers.h>
+
+typedef uint32_t zmk_key_t;
+typedef uint8_t zmk_mod_t;
+typedef uint8_t zmk_mod_flags_t;
+
+static inline bool is_mod(uint16_t usage_page, uint32_t keycode) {
+  return usage_page == HID_USAGE_KEY && keycode >= HID_USAGE_KEY_KEYBOARD_LEFTCONTROL &&
+         keycode <= HID_USAGE_KEY_KEYBOARD_RIGHT_GUI;
+}
+
+#endif // HARNESS_ZMK_KEYS_H
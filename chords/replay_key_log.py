@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""
+Replays the timestamped key log in key_log.sqlite through a model of ZMK's
+combo engine, configured from the combos in config/chords.keymap and the key
+positions in config/glove80.keymap.
+
+Every logged key is mapped back to its key position on the Glove80 (Colemak DH
+on a Swedish host) and pressed at its logged time. The model holds a key that
+could start a combo until the combo completes, a key that rules it out arrives,
+the combo's timeout-ms expires or the key is released (assumed --hold-ms after
+the press). It reports:
+
+  - chord misfires: combos that normal typing would have triggered,
+  - latency added per keystroke while keys are held back for combos,
+  - HID reports sent for the whole log.
+
+To see what a chord change does, edit chords.keymap and re-run, or try a
+timeout without editing anything:
+
+    python3 chords/replay_key_log.py
+    python3 chords/replay_key_log.py --timeout ch_qmark=30 --hold-ms 80
+    python3 chords/replay_key_log.py --layer ENGLISH_CHORDS --examples 10
+
+This is a model, not the firmware: it does not see key releases (the log only
+has presses) and treats every combo as a plain set of positions.
+"""
+
+import argparse
+import re
+import sqlite3
+import statistics
+import sys
+import time
+from collections import Counter, defaultdict
+from dataclasses import dataclass
+from datetime import datetime
+from pathlib import Path
+
+# --- Configuration ---
+CHORDS_DIR = Path(__file__).parent
+CONFIG_DIR = CHORDS_DIR.parent / "config"
+KEY_LOG_FILE = CHORDS_DIR / "key_log.sqlite"
+KEYMAP_FILE = CONFIG_DIR / "glove80.keymap"
+COMBO_FILES = [CONFIG_DIR / "chords.keymap", CONFIG_DIR / "generated_chords.keymap"]
+
+# Logged key -> key position name in glove80.keymap. Letters map to K<letter>.
+KEY_TO_POSITION = {
+    "å": "KARING",
+    "ä": "KAUML",
+    "ö": "KOUML",
+    ".": "KDOT",
+    ",": "KCOMMA",
+    "-": "KMINUS",
+    "<space>": "KSPACE",
+}
+
+# Gaps shorter than this are a macro or chord typing, not fingers
+DEFAULT_MACRO_GAP_MS = 8
+# A pause this long starts a new typing session
+SESSION_GAP_MS = 2000
+
+
+@dataclass
+class Combo:
+    name: str
+    positions: frozenset
+    timeout_ms: int
+    binding: str
+
+
+@dataclass
+class Press:
+    time_ms: float
+    key: str
+    position: int | None   # None: not on a combo-capable key, or machine typed
+    mods: int              # Modifiers logged with the key, e.g. "<cmd> + c"
+
+
+def strip_comments(text: str) -> str:
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.DOTALL)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def read_file(path: Path) -> str:
+    try:
+        return path.read_text(encoding="utf-8")
+    except IOError as e:
+        print(f"Error reading {path}: {e}", file=sys.stderr)
+        sys.exit(1)
+
+
+def parse_defines(path: Path) -> dict[str, int]:
+    """Numeric #defines: key positions (KA 35) and layers (ALPHA 0)."""
+    return {name: int(value) for name, value in
+            re.findall(r"^#define\s+(\w+)\s+(\d+)\s*$", read_file(path), re.MULTILINE)}
+
+
+def parse_combos(paths: list[Path], defines: dict[str, int], layer: str) -> list[Combo]:
+    """LAYER_CHORD(name, binding, positions, layers, timeout) active on a layer."""
+    pattern = re.compile(
+        r"^\s*LAYER_CHORD\((\w+),\s*([^,]+),\s*([\w ]+),\s*([\w ]+),\s*(\d+)\)", re.MULTILINE)
+    combos = []
+    for path in paths:
+        if not path.exists():
+            continue
+        for name, binding, keys, layers, timeout in pattern.findall(strip_comments(read_file(path))):
+            if layer not in layers.split():
+                continue
+            unknown = [key for key in keys.split() if key not in defines]
+            if unknown:
+                print(f"Warning: combo {name} uses unknown positions {unknown}, skipping.", file=sys.stderr)
+                continue
+            combos.append(Combo(name, frozenset(defines[key] for key in keys.split()),
+                                int(timeout), binding.strip()))
+    return combos
+
+
+def parse_key_code(key_code: str) -> tuple[str, int]:
+    """'<cmd> + c' -> ('c', 1); 'e' -> ('e', 0)."""
+    parts = [part.strip() for part in key_code.split(" + ")]
+    return parts[-1], len(parts) - 1
+
+
+def load_presses(path: Path, defines: dict[str, int], macro_gap_ms: float) -> list[Press]:
+    if not path.exists():
+        print(f"Error: {path} not found", file=sys.stderr)
+        sys.exit(1)
+    conn = sqlite3.connect(path)
+    rows = conn.execute("SELECT time_utc, key_code FROM key_log ORDER BY time_utc").fetchall()
+    conn.close()
+
+    presses = []
+    previous_ms = None
+    for time_utc, key_code in rows:
+        time_ms = datetime.fromisoformat(time_utc).timestamp() * 1000
+        key, mods = parse_key_code(key_code)
+        name = KEY_TO_POSITION.get(key.lower(), f"K{key.upper()}" if len(key) == 1 and key.isalpha() else None)
+        position = defines.get(name) if mods == 0 else None
+        if previous_ms is not None and time_ms - previous_ms < macro_gap_ms:
+            position = None  # Machine typed, combos never see it
+        presses.append(Press(time_ms, key, position, mods))
+        previous_ms = time_ms
+    return presses
+
+
+class ComboModel:
+    """Holds back combo candidates like ZMK's combo engine does."""
+
+    def __init__(self, combos: list[Combo], hold_ms: float):
+        self.combos = combos
+        self.hold_ms = hold_ms
+        self.by_position = defaultdict(list)
+        for combo in combos:
+            for position in combo.positions:
+                self.by_position[position].append(combo)
+        self.pending: list[Press] = []
+        self.delays: list[float] = []
+        self.delays_by_key = defaultdict(list)
+        self.misfires = Counter()
+        self.misfire_examples = defaultdict(list)
+
+    def candidates(self, positions: set) -> list[Combo]:
+        first = next(iter(positions))
+        return [combo for combo in self.by_position[first] if positions <= combo.positions]
+
+    def deadline(self) -> float:
+        """When the pending keys are released to the host as plain keys."""
+        timeout = max(combo.timeout_ms for combo in self.candidates({p.position for p in self.pending}))
+        return self.pending[0].time_ms + min(timeout, self.hold_ms)
+
+    def release_pending(self, at_ms: float):
+        for press in self.pending:
+            self.record(press, at_ms - press.time_ms)
+        self.pending = []
+
+    def record(self, press: Press, delay: float):
+        self.delays.append(delay)
+        self.delays_by_key[press.key].append(delay)
+
+    def press(self, press: Press, context: str):
+        if self.pending and press.time_ms >= self.deadline():
+            self.release_pending(self.deadline())
+
+        if self.pending:
+            positions = {p.position for p in self.pending}
+            if press.position is not None:
+                positions.add(press.position)
+                elapsed = press.time_ms - self.pending[0].time_ms
+                candidates = [combo for combo in self.candidates(positions) if elapsed < combo.timeout_ms]
+            else:
+                candidates = []
+            if candidates:
+                self.pending.append(press)
+                exact = [combo for combo in candidates if combo.positions == positions]
+                if exact and len(candidates) == 1:
+                    self.fire(exact[0], press.time_ms, context)
+                return
+            self.release_pending(press.time_ms)
+
+        if press.position is not None and self.by_position[press.position]:
+            self.pending = [press]
+        else:
+            self.record(press, 0.0)
+
+    def fire(self, combo: Combo, at_ms: float, context: str):
+        self.misfires[combo.name] += 1
+        if len(self.misfire_examples[combo.name]) < 20:
+            self.misfire_examples[combo.name].append(context)
+        self.release_pending(at_ms)
+
+    def finish(self):
+        if self.pending:
+            self.release_pending(self.deadline())
+
+
+def context_around(presses: list[Press], index: int, width: int = 12) -> str:
+    def show(press: Press) -> str:
+        if press.key == "<space>":
+            return " "
+        return press.key if len(press.key) == 1 else f"[{press.key.strip('<>')}]"
+    before = "".join(show(p) for p in presses[max(0, index - width):index])
+    after = "".join(show(p) for p in presses[index:index + 3])
+    return f"{before}|{after}"
+
+
+def percentile(values: list[float], fraction: float) -> float:
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))] if ordered else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay key_log.sqlite through a model of the combo engine.")
+    parser.add_argument("--layer", default="ALPHA", help="Layer the log was typed on (default: ALPHA)")
+    parser.add_argument("--hold-ms", type=float, default=100,
+                        help="Assumed time a key is held before release (default: 100)")
+    parser.add_argument("--macro-gap-ms", type=float, default=DEFAULT_MACRO_GAP_MS,
+                        help=f"Keys closer than this are machine typed (default: {DEFAULT_MACRO_GAP_MS})")
+    parser.add_argument("--timeout", action="append", default=[], metavar="COMBO=MS",
+                        help="Override a combo's timeout-ms, e.g. ch_qmark=30 (repeatable)")
+    parser.add_argument("--examples", type=int, default=3, help="Misfire examples to show per combo")
+    args = parser.parse_args()
+
+    defines = parse_defines(KEYMAP_FILE)
+    if args.layer not in defines:
+        print(f"Error: unknown layer {args.layer}", file=sys.stderr)
+        sys.exit(1)
+    combos = parse_combos(COMBO_FILES, defines, args.layer)
+    for override in args.timeout:
+        name, _, value = override.partition("=")
+        matches = [combo for combo in combos if combo.name in (name, f"chord_{name}")]
+        if not matches or not value.isdigit():
+            print(f"Error: bad --timeout {override}", file=sys.stderr)
+            sys.exit(1)
+        for combo in matches:
+            combo.timeout_ms = int(value)
+
+    presses = load_presses(KEY_LOG_FILE, defines, args.macro_gap_ms)
+    started = time.perf_counter()
+    model = ComboModel(combos, args.hold_ms)
+    sessions = 1
+    for index, press in enumerate(presses):
+        if index and press.time_ms - presses[index - 1].time_ms > SESSION_GAP_MS:
+            model.finish()
+            sessions += 1
+        model.press(press, context_around(presses, index))
+    model.finish()
+    elapsed = time.perf_counter() - started
+
+    # Two reports per tap, plus a press and release for every logged modifier
+    reports = sum(2 + 2 * press.mods for press in presses)
+    delayed = [delay for delay in model.delays if delay > 0]
+    print(f"Replayed {len(presses)} key presses in {sessions} sessions through {len(combos)} "
+          f"{args.layer} combos ({len(presses) / elapsed * 60:,.0f} presses/minute)")
+    print(f"  HID reports sent:              {reports}")
+    print(f"  chord misfires:                {sum(model.misfires.values())}")
+    print(f"  keys held back for combos:     {len(delayed)} ({len(delayed) / len(presses):.1%})")
+    print(f"  added latency per keystroke:   {statistics.fmean(model.delays):.1f} ms mean, "
+          f"p50 {percentile(delayed, 0.5):.0f} ms, p95 {percentile(delayed, 0.95):.0f} ms "
+          f"of held keys, max {max(model.delays, default=0):.0f} ms")
+
+    if model.misfires:
+        print("  misfires by combo:")
+        by_name = {combo.name: combo for combo in combos}
+        for name, count in model.misfires.most_common():
+            combo = by_name[name]
+            print(f"    {name} ({combo.binding}, {combo.timeout_ms} ms): {count}")
+            for example in model.misfire_examples[name][:args.examples]:
+                print(f"        '{example}'")
+
+    print("  keys adding the most latency:")
+    totals = sorted(((sum(d), key, len(d)) for key, d in model.delays_by_key.items()), reverse=True)
+    for total, key, count in totals[:8]:
+        print(f"    {key!r}: {total / 1000:.1f} s over {count} presses")
+
+
+if __name__ == "__main__":
+    main()
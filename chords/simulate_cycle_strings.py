@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Measures what a cycle string press costs before flashing a board, on the real
+behavior code.
+
+Builds chords/harness/cycle_string_harness.c with behavior_cycle_string.c,
+cycle_string_emit.c and cycle_string_tables.c from custom_behavior/, against
+the stand-ins for Zephyr and ZMK in chords/harness/include/, with the Kconfig
+symbols of the chosen host layout and emit mode, once with
+CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE (the Kconfig default) and once
+without unless --sentence-case picks one. The harness presses every
+cycle list through the behavior's driver API and counts the keycode events
+raised (or HID reports sent in direct mode), the listener calls they cause and
+the keys the host sees, and checks the text each press leaves on screen and
+what typing around the strings does (Shift, punctuation, sentence case).
+
+Run from anywhere, with a C compiler (cc, or --cc / $CC):
+    python3 chords/simulate_cycle_strings.py [--layout SE] [--emit events]
+    python3 chords/simulate_cycle_strings.py --list 1        # trace one list
+    python3 chords/simulate_cycle_strings.py --max-events-per-press 40
+    python3 chords/simulate_cycle_strings.py --sentence-case off
+
+It exits non-zero when a press types the wrong text, and with
+--max-events-per-press or --max-events-per-word when the average goes above
+the limit, so a table or emitter change that breaks typing or makes it more
+expensive shows up before it reaches the keyboard.
+"""
+
+import argparse
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+from dataclasses import dataclass
+from pathlib import Path
+
+# --- Configuration ---
+BEHAVIOR_DIR = Path(__file__).parent.parent / "custom_behavior"
+HARNESS_DIR = Path(__file__).parent / "harness"
+HARNESS_SOURCES = [
+    HARNESS_DIR / "cycle_string_harness.c",
+    BEHAVIOR_DIR / "behavior_cycle_string.c",
+    BEHAVIOR_DIR / "cycle_string_emit.c",
+    BEHAVIOR_DIR / "cycle_string_tables.c",
+]
+
+LAYOUTS = ["SE", "US", "US_INTL", "DE"]
+EMIT_MODES = ["events", "hid"]
+SENTENCE_CASE = {"on": [True], "off": [False], "both": [True, False]}
+
+
+@dataclass
+class PressCost:
+    """One press as the harness measured it, a line of its --presses output."""
+    list_index: int
+    variant: int
+    events: int
+    reports: int
+    listener_calls: int
+    taps: int
+    backspaces: int
+
+
+def build_harness(output: Path, layout: str, emit: str, sentence_case: bool, cc: str):
+    defines = [
+        "CONFIG_ZMK_LOG_LEVEL=0",
+        "CONFIG_ZMK_BEHAVIOR_CYCLE_STRING=1",
+        f"CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_{layout}=1",
+    ]
+    if sentence_case:
+        defines.append("CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE=1")
+    if emit == "hid":
+        defines.append("CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_EMIT_HID_DIRECT=1")
+    command = [*shlex.split(cc), "-std=gnu11", "-O1", f"-I{HARNESS_DIR / 'include'}",
+               f"-I{BEHAVIOR_DIR}", *(f"-D{define}" for define in defines),
+               *map(str, HARNESS_SOURCES), "-o", str(output)]
+    try:
+        result = subprocess.run(command, capture_output=True, text=True)
+    except OSError as e:
+        print(f"Error running the compiler '{cc}': {e}", file=sys.stderr)
+        sys.exit(1)
+    if result.returncode != 0:
+        print(f"Error building the harness:\n{result.stderr}", file=sys.stderr)
+        sys.exit(1)
+
+
+def run_harness(layout: str, emit: str, arguments: list[str], sentence_case: bool = True,
+                cc: str = None, capture: bool = False) -> subprocess.CompletedProcess:
+    """Builds the harness for a layout and emit mode and runs it."""
+    with tempfile.TemporaryDirectory() as directory:
+        harness = Path(directory) / "cycle_string_harness"
+        build_harness(harness, layout, emit, sentence_case, cc or os.environ.get("CC", "cc"))
+        return subprocess.run([str(harness), *arguments], capture_output=capture,
+                              text=True, errors="replace")
+
+
+def press_costs(layout: str, emit: str, cycles: int = 1) -> list[PressCost]:
+    """Every press of every list: the first press, then `cycles` full passes."""
+    result = run_harness(layout, emit, ["--presses", "--cycles", str(cycles)], capture=True)
+    if result.returncode != 0:
+        print(result.stderr, end="", file=sys.stderr)
+        sys.exit(1)
+    return [PressCost(*map(int, line.split())) for line in result.stdout.splitlines()]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure the cost of cycle string presses.")
+    parser.add_argument("--layout", choices=LAYOUTS, default="SE")
+    parser.add_argument("--emit", choices=EMIT_MODES, default="events",
+                        help="events: a keycode event per transition; hid: reports written directly")
+    parser.add_argument("--cycles", type=int, default=1,
+                        help="Full passes through each list after the first press")
+    parser.add_argument("--list", type=int, help="Trace every press of a single list")
+    parser.add_argument("--max-events-per-press", type=float,
+                        help="Fail if the average events (reports with --emit hid) per press is higher")
+    parser.add_argument("--max-events-per-word", type=float,
+                        help="Fail if the average events (reports with --emit hid) of a first press is higher")
+    parser.add_argument("--sentence-case", choices=SENTENCE_CASE, default="both",
+                        help="Build with CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE, without, or run both")
+    parser.add_argument("--cc", help="C compiler for the harness (default $CC or cc)")
+    args = parser.parse_args()
+
+    arguments = ["--cycles", str(args.cycles)]
+    if args.list is not None:
+        arguments += ["--list", str(args.list)]
+    if args.max_events_per_press is not None:
+        arguments += ["--max-events-per-press", str(args.max_events_per_press)]
+    if args.max_events_per_word is not None:
+        arguments += ["--max-events-per-word", str(args.max_events_per_word)]
+    returncode = 0
+    for sentence_case in SENTENCE_CASE[args.sentence_case]:
+        sys.stdout.flush()
+        result = run_harness(args.layout, args.emit, arguments, sentence_case, args.cc)
+        returncode = max(returncode, result.returncode)
+    sys.exit(returncode)
+
+
+if __name__ == "__main__":
+    main()
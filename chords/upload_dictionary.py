@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""
+Builds a dictionary image from the same sources as the generators, the cycle
+lists in custom_behavior/cycle_string_lists.h and the chords in
+chords/jocke_chords.json, and uploads it to a keyboard running with
+CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT. The keyboard types from it as
+soon as it is loaded, no firmware build or reboot needed. See
+custom_behavior/cycle_string_flash_dict.h for the image format.
+
+The upload goes over the keyboard's shell, e.g. the USB serial shell, as
+"cycle_str dict" commands: erase, hex writes, then load, which checks the
+image and switches to it. Lists and chords have to fit the capacities the
+firmware was built with (CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT_MAX_*);
+an image past them is rejected and the built-in tables stay in use.
+
+Run from the repository root:
+    python3 chords/upload_dictionary.py --port /dev/ttyACM0
+    python3 chords/upload_dictionary.py --output dictionary.bin
+"""
+
+import argparse
+import os
+import re
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+import zlib
+
+from generate_cycle_string_table import INPUT_LISTS_FILE, build_table, parse_cycle_lists
+from generate_zmk_chords import (CHORD_MASK_WORDS, CHORD_NO_LAYER, CHORD_EXTENDS, CORPUS_FILE,
+                                 build_chord_engine, build_type_strings, load_chords,
+                                 load_word_counts)
+
+# Must match custom_behavior/cycle_string_flash_dict.h
+DICT_MAGIC = 0x54434944
+DICT_VERSION = 2
+DICT_HEADER_FORMAT = "<IHBBIII"
+DICT_SECTIONS = 10
+DICT_HEADER_SIZE = struct.calcsize(DICT_HEADER_FORMAT) + DICT_SECTIONS * 8
+
+# Bytes per write command: the firmware takes up to 128, and the hex has to
+# fit the shell's command line with the rest of the command
+WRITE_CHUNK = 96
+COMMAND_TIMEOUT_S = 10
+ANSI_ESCAPE = re.compile(r"\x1b\[[0-9;?]*[A-Za-z]")
+
+
+def pack_lists(refs):
+    return b"".join(struct.pack("<HBB", offset, count, wrap_prefix)
+                    for offset, count, wrap_prefix in refs)
+
+
+def pack_u16(values):
+    return struct.pack(f"<{len(values)}H", *values)
+
+
+def build_image():
+    """The dictionary image and a summary of what is in it."""
+    table = build_table(parse_cycle_lists(INPUT_LISTS_FILE))
+    engine_chords, strings, _, _, _ = load_chords()
+    type_blob, type_refs = build_type_strings(strings)
+    engine = build_chord_engine(engine_chords, load_word_counts(CORPUS_FILE))
+
+    entries = bytearray()
+    for key in engine["slots"]:
+        if key is None:
+            entries += struct.pack(f"<{CHORD_MASK_WORDS}IBBH", *[0] * CHORD_MASK_WORDS,
+                                   CHORD_NO_LAYER, 0, 0)
+            continue
+        mask, layer = key
+        flags = CHORD_EXTENDS if key in engine["extended"] else 0
+        entries += struct.pack(f"<{CHORD_MASK_WORDS}IBBH", *mask, layer, flags,
+                               engine["words"][key][0])
+
+    # In the order of enum cycle_string_flash_dict_section
+    sections = [
+        table["blob"],
+        pack_lists(table["refs"]),
+        pack_u16(table["usage_base"]),
+        type_blob,
+        # One variant each, sharing all of itself when it wraps around
+        pack_lists((offset, 1, length) for offset, length in type_refs),
+        pack_u16(engine["seeds"]),
+        bytes(entries),
+        pack_u16(engine["offsets"]),
+        pack_u16(engine["candidates"]),
+        b"".join(struct.pack(f"<{CHORD_MASK_WORDS}IB3x", *engine["keys_masks"][layer], layer)
+                 for layer in engine["layers"]),
+    ]
+    body = bytearray()
+    refs = []
+    for data in sections:
+        body += bytes(-(DICT_HEADER_SIZE + len(body)) % 4)
+        refs.append((DICT_HEADER_SIZE + len(body), len(data)))
+        body += data
+    # Flash is written in whole words
+    body += bytes(-(DICT_HEADER_SIZE + len(body)) % 4)
+
+    header = struct.pack(DICT_HEADER_FORMAT, DICT_MAGIC, DICT_VERSION, engine["max_keys"], 0,
+                         DICT_HEADER_SIZE + len(body), zlib.crc32(body), table["crc"])
+    header += b"".join(struct.pack("<II", offset, length) for offset, length in refs)
+    summary = (f"{len(table['refs'])} lists of up to {table['max_variants']} variants, "
+               f"{len(strings)} type strings, {len(engine['words'])} chords of up to "
+               f"{engine['max_keys']} keys")
+    return header + bytes(body), summary
+
+
+class Shell:
+    """Line-at-a-time access to the keyboard's shell on a serial port."""
+
+    def __init__(self, port, prompt):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        self.saved = termios.tcgetattr(self.fd)
+        tty.setraw(self.fd)
+        self.prompt = prompt
+        self.run("")
+
+    def close(self):
+        termios.tcsetattr(self.fd, termios.TCSADRAIN, self.saved)
+        os.close(self.fd)
+
+    def run(self, command):
+        """Sends a command and returns what it printed, without the echo and
+        the prompt."""
+        os.write(self.fd, command.encode("ascii") + b"\r")
+        output = ""
+        deadline = time.monotonic() + COMMAND_TIMEOUT_S
+        while not output.rstrip().endswith(self.prompt.rstrip()):
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+                raise TimeoutError(f"no prompt after '{command[:40]}'")
+            output += ANSI_ESCAPE.sub("", os.read(self.fd, 4096).decode("latin-1"))
+        output = output.rstrip()[:-len(self.prompt.rstrip())]
+        # The echo may be wrapped at the terminal width, so compare without
+        # whitespace
+        echo = re.sub(r"\s+", "", command)
+        seen = 0
+        for i, char in enumerate(output):
+            if seen == len(echo):
+                return output[i:].strip()
+            if char.isspace():
+                continue
+            if char != echo[seen]:
+                break
+            seen += 1
+        return "" if seen == len(echo) else output.strip()
+
+
+def upload(shell, image):
+    def expect(command, success):
+        """Runs a command; success is what it prints when it worked, or None
+        for commands that print nothing then."""
+        output = shell.run(command)
+        if (output != "") if success is None else (success not in output):
+            raise RuntimeError(f"'{command[:40]}' failed: {output}")
+        return output
+
+    print(expect(f"cycle_str dict erase {len(image)}", "Dictionary erased"))
+    for offset in range(0, len(image), WRITE_CHUNK):
+        expect(f"cycle_str dict write {offset} {image[offset:offset + WRITE_CHUNK].hex()}", None)
+        print(f"\rWrote {min(offset + WRITE_CHUNK, len(image))} of {len(image)} bytes", end="")
+    print()
+    print(expect("cycle_str dict load", "Dictionary loaded"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build a dictionary image and upload it to the keyboard.")
+    parser.add_argument("--port", help="Serial port of the keyboard's shell, e.g. /dev/ttyACM0")
+    parser.add_argument("--output", help="Also write the image to this file")
+    parser.add_argument("--prompt", default="uart:~$ ", help="The shell's prompt")
+    args = parser.parse_args()
+    if not args.port and not args.output:
+        parser.error("give --port, --output or both")
+
+    image, summary = build_image()
+    print(f"Built a {len(image)} byte dictionary: {summary}")
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(image)
+        print(f"Successfully created '{args.output}'")
+    if args.port:
+        shell = Shell(args.port, args.prompt)
+        try:
+            upload(shell, image)
+        except (RuntimeError, TimeoutError) as e:
+            print(f"\nError: {e}", file=sys.stderr)
+            sys.exit(1)
+        finally:
+            shell.close()
+
+
+if __name__ == "__main__":
+    main()
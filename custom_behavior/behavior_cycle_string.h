@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_BEHAVIOR_CYCLE_STRING_H
+#define CUSTOM_BEHAVIOR_BEHAVIOR_CYCLE_STRING_H
+
+// End every cycle sequence in progress, for other behaviors that type text:
+// a repeat press after it must not backspace over what they typed
+void cycle_string_end_sequences(void);
+
+#endif // CUSTOM_BEHAVIOR_BEHAVIOR_CYCLE_STRING_H
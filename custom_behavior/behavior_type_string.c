@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DT_DRV_COMPAT chord_cycle_behavior_type_string
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <drivers/behavior.h>
+#include <zmk/behavior.h>
+
+#include "behavior_cycle_string.h"
+#include "cycle_string_emit.h"
+#include "cycle_string_tables.h"
+
+// One device types every word: the binding parameter picks the string, where
+// a macro per word would need a devicetree node, a binding array and a
+// behavior queue entry per keystroke each.
+
+static int behavior_type_string_init(const struct device *dev) { return 0; }
+
+static int on_keymap_binding_pressed(struct zmk_behavior_binding *binding,
+                                     struct zmk_behavior_binding_event event) {
+  uint32_t index = binding->param1;
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  if (index >= tables->type_strings_len) {
+    LOG_ERR("Invalid type string index %d for behavior %s", index, binding->behavior_dev);
+    return ZMK_BEHAVIOR_OPAQUE;
+  }
+
+  // The word is typed after whatever a cycle sequence typed, so a repeat
+  // press there starts over instead of backspacing over it
+  cycle_string_end_sequences();
+
+  // Held or sticky Shift capitalizes the word, so no shifted copy of each
+  // chord is needed; the trailing space is part of the string unless the
+  // chord is exact
+  struct cycle_string_burst burst = {.blob = tables->type_blob,
+                                     .list = &tables->type_strings[index],
+                                     .capitalize = cycle_string_emit_capitalize()};
+  cycle_string_emit_burst(&burst);
+  return ZMK_BEHAVIOR_OPAQUE;
+}
+
+static int on_keymap_binding_released(struct zmk_behavior_binding *binding,
+                                      struct zmk_behavior_binding_event event) {
+  return ZMK_BEHAVIOR_OPAQUE;
+}
+
+static const struct behavior_driver_api behavior_type_string_driver_api = {
+    .binding_pressed = on_keymap_binding_pressed,
+    .binding_released = on_keymap_binding_released,
+};
+
+#define TYPE_STR_INST(n)                                                       \
+  BEHAVIOR_DT_INST_DEFINE(n, behavior_type_string_init, NULL, NULL, NULL,      \
+                          POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,    \
+                          &behavior_type_string_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(TYPE_STR_INST)
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/event_manager.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/position_state_changed.h>
+#include <zmk/keymap.h>
+#include <zmk/matrix.h>
+
+#include "behavior_cycle_string.h"
+#include "cycle_string_emit.h"
+#include "cycle_string_tables.h"
+
+// Word chords without a zmk,combos node each: presses of chord keys are held
+// back while their mask grows, and every press looks the mask up in the
+// perfect hash and, if it is no chord, among the active layer's chords on the
+// pressed key. A chord that is not part of a longer one is typed right away,
+// and a press no chord can contain ends the held keys there. Otherwise they
+// wait for a release, a key outside the layer's chords or the timeout. Ending
+// types the held chord's string, or lets the held presses through in order as
+// if nothing happened.
+
+BUILD_ASSERT(ZMK_KEYMAP_LEN <= CHORD_ENGINE_MASK_WORDS * 32,
+             "chord masks have fewer bits than the keymap has positions");
+
+// All state is touched from the system work queue only: position events are
+// raised there and so does the timeout run
+static uint32_t held[CHORD_ENGINE_MASK_WORDS];     // Captured, chord not resolved yet
+static uint32_t consumed[CHORD_ENGINE_MASK_WORDS]; // Keys of a typed chord, still down
+static struct zmk_position_state_changed_event captured[CHORD_ENGINE_KEYS_CAPACITY];
+static uint8_t captured_len;
+
+// Chords of the active layer, found again when the layer or the tables change
+// so a press only ever sees that layer's index
+static const struct cycle_string_tables *indexed_tables;
+static const struct chord_engine_layer *layer_index; // NULL if the layer has no chords
+static const uint16_t *layer_rows;
+static uint8_t active_layer;
+
+static inline bool mask_test(const uint32_t *mask, uint32_t position) {
+  return position < CHORD_ENGINE_MASK_WORDS * 32 && (mask[position / 32] & BIT(position % 32));
+}
+
+static inline void mask_set(uint32_t *mask, uint32_t position) {
+  mask[position / 32] |= BIT(position % 32);
+}
+
+static inline void mask_clear(uint32_t *mask, uint32_t position) {
+  mask[position / 32] &= ~BIT(position % 32);
+}
+
+static void index_layer(const struct cycle_string_tables *tables) {
+  indexed_tables = tables;
+  active_layer = zmk_keymap_highest_layer_active();
+  layer_index =
+      chord_engine_layer_find(tables->chord_layers, tables->chord_layers_len, active_layer);
+  layer_rows = layer_index == NULL ? NULL
+                                   : &tables->chord_offsets[(layer_index - tables->chord_layers) *
+                                                            tables->chord_positions];
+}
+
+// The tables in use, with the active layer's index up to date
+static inline const struct cycle_string_tables *indexed(void) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  if (tables != indexed_tables) {
+    index_layer(tables);
+  }
+  return tables;
+}
+
+static inline const struct chord_engine_entry *lookup_held(void) {
+  const struct cycle_string_tables *tables = indexed();
+  return chord_engine_lookup(tables->chord_entries, tables->chord_slots, tables->chord_seeds,
+                             tables->chord_buckets, held, active_layer);
+}
+
+// Whether the held keys, the last at position, can still become a chord
+static inline bool held_can_grow(const struct chord_engine_entry *entry, uint32_t position) {
+  if (entry != NULL) {
+    return entry->flags & CHORD_ENGINE_EXTENDS;
+  }
+  const struct cycle_string_tables *tables = indexed();
+  return layer_index != NULL &&
+         chord_engine_grows(tables->chord_entries, layer_rows, tables->chord_positions,
+                            tables->chord_candidates, held, position);
+}
+
+// Type the chord the held keys make on the active layer, if they make one
+static bool type_chord(void) {
+  const struct chord_engine_entry *entry = lookup_held();
+  if (entry == NULL) {
+    return false;
+  }
+  // Same as &type_str: a cycle press afterwards starts over
+  cycle_string_end_sequences();
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  struct cycle_string_burst burst = {.blob = tables->type_blob,
+                                     .list = &tables->type_strings[entry->string],
+                                     .capitalize = cycle_string_emit_capitalize()};
+  cycle_string_emit_burst(&burst);
+  for (int i = 0; i < CHORD_ENGINE_MASK_WORDS; ++i) {
+    consumed[i] |= held[i];
+  }
+  return true;
+}
+
+// Registered below; replayed presses resume after it
+extern const struct zmk_listener zmk_listener_chord_engine;
+
+static void chord_timeout_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(chord_timeout, chord_timeout_handler);
+
+// End the chord in progress: type it, or let its key presses through
+static void resolve(void) {
+  k_work_cancel_delayable(&chord_timeout);
+  uint8_t len = captured_len;
+  bool typed = type_chord();
+  memset(held, 0, sizeof(held));
+  captured_len = 0;
+  if (!typed) {
+    for (uint8_t i = 0; i < len; ++i) {
+      ZMK_EVENT_RAISE_AFTER(captured[i], chord_engine);
+    }
+  }
+}
+
+static void chord_timeout_handler(struct k_work *work) {
+  if (captured_len != 0) {
+    resolve();
+  }
+}
+
+static int chord_engine_listener(const zmk_event_t *eh) {
+  if (as_zmk_layer_state_changed(eh) != NULL) {
+    index_layer(cycle_string_tables_get());
+    return ZMK_EV_EVENT_BUBBLE;
+  }
+  const struct zmk_position_state_changed *ev = as_zmk_position_state_changed(eh);
+  if (ev == NULL) {
+    return ZMK_EV_EVENT_BUBBLE;
+  }
+
+  if (!ev->state) {
+    // Letting go of a held key ends the chord there
+    if (mask_test(held, ev->position)) {
+      resolve();
+    }
+    // A typed chord's keys already did their job, their releases go nowhere
+    if (mask_test(consumed, ev->position)) {
+      mask_clear(consumed, ev->position);
+      return ZMK_EV_EVENT_CAPTURED;
+    }
+    return ZMK_EV_EVENT_BUBBLE;
+  }
+
+  const struct cycle_string_tables *tables = indexed();
+  if (layer_index == NULL || !mask_test(layer_index->keys, ev->position)) {
+    // No chord on the layer can include this press, so end the one in
+    // progress first and let this key follow it
+    if (captured_len != 0) {
+      resolve();
+    }
+    return ZMK_EV_EVENT_BUBBLE;
+  }
+
+  mask_set(held, ev->position);
+  const struct chord_engine_entry *entry = lookup_held();
+  bool grows = held_can_grow(entry, ev->position);
+  if (captured_len != 0 &&
+      ((entry == NULL && !grows) || captured_len >= tables->chord_max_keys)) {
+    // The held keys cannot grow into a chord with this one: end them without
+    // waiting, and let this key start the next chord
+    mask_clear(held, ev->position);
+    resolve();
+    mask_set(held, ev->position);
+    entry = lookup_held();
+    grows = held_can_grow(entry, ev->position);
+  }
+
+  if (captured_len == 0) {
+    k_work_reschedule(&chord_timeout, K_MSEC(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE_TIMEOUT_MS));
+  }
+  captured[captured_len++] = copy_raised_zmk_position_state_changed(ev);
+
+  // A chord that is not part of a longer one is typed now, not at the
+  // timeout or the first release
+  if (entry != NULL && !grows) {
+    resolve();
+  }
+  return ZMK_EV_EVENT_CAPTURED;
+}
+
+ZMK_LISTENER(chord_engine, chord_engine_listener);
+ZMK_SUBSCRIPTION(chord_engine, zmk_position_state_changed);
+ZMK_SUBSCRIPTION(chord_engine, zmk_layer_state_changed);
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CHORD_ENGINE_DICT_H
+#define CUSTOM_BEHAVIOR_CHORD_ENGINE_DICT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+// Word chord dictionary format, produced by chords/generate_zmk_chords.py.
+//
+// A chord is the set of key positions pressed together, as a bitmask, plus
+// the layer it is defined on. The dictionary is a minimal perfect hash of
+// (mask, layer) in two levels, "hash and displace": the key hashed with
+// seed 0 picks a bucket, and the key hashed with that bucket's seed picks
+// its slot. The generator searches a seed per bucket so that no two entries
+// share a slot, so a lookup is two hashes and one compare however many
+// chords there are. A mask without an entry lands on some slot too; the
+// stored key tells them apart.
+//
+// Next to the hash, each layer with chords has a candidate index in
+// compressed sparse rows listing its chords on each key position. Layer l
+// (the l-th in the layer table) has rows = offsets + l * positions, and
+// candidates[rows[p]] up to candidates[rows[p + 1]] are the entry slots of
+// its chords with key p. It takes a slot per key of each chord, not a row
+// per position as wide as the busiest one, and a scan only sees the chords
+// of the active layer however many other layers have. Rows list the most
+// typed words first, so a scan that stops at the first fit mostly stops
+// early.
+
+// Enough words for 96 key positions, the Glove80 has 80
+#define CHORD_ENGINE_MASK_WORDS 3
+
+// Layer of an unused slot, never the active layer
+#define CHORD_ENGINE_NO_LAYER UINT8_MAX
+
+// Some longer chord on the layer contains this one, so it can still grow
+#define CHORD_ENGINE_EXTENDS BIT(0)
+
+struct chord_engine_entry {
+  uint32_t mask[CHORD_ENGINE_MASK_WORDS]; // Bit n is key position n
+  uint8_t layer;
+  uint8_t flags;
+  uint16_t string; // Index into type_string_table.h
+};
+
+// The chords of one layer: the key positions they use, located in the
+// candidate index by where the entry is in the layer table
+struct chord_engine_layer {
+  uint32_t keys[CHORD_ENGINE_MASK_WORDS]; // Every key position of some chord on the layer
+  uint8_t layer;
+};
+
+// The chords of a layer, or NULL if it has none
+static inline const struct chord_engine_layer *
+chord_engine_layer_find(const struct chord_engine_layer *layers, size_t count, uint8_t layer) {
+  for (size_t i = 0; i < count; ++i) {
+    if (layers[i].layer == layer) {
+      return &layers[i];
+    }
+  }
+  return NULL;
+}
+
+static inline uint32_t chord_engine_murmur_block(uint32_t h, uint32_t k) {
+  k *= 0xCC9E2D51u;
+  k = (k << 15) | (k >> 17);
+  k *= 0x1B873593u;
+  h ^= k;
+  h = (h << 13) | (h >> 19);
+  return h * 5 + 0xE6546B64u;
+}
+
+// MurmurHash3 (x86, 32-bit) of the mask words and then the layer. The
+// generator computes the same hash in Python; change both together.
+static inline uint32_t chord_engine_hash(const uint32_t *mask, uint8_t layer, uint32_t seed) {
+  uint32_t h = seed;
+  for (int i = 0; i < CHORD_ENGINE_MASK_WORDS; ++i) {
+    h = chord_engine_murmur_block(h, mask[i]);
+  }
+  h = chord_engine_murmur_block(h, layer);
+  h ^= (CHORD_ENGINE_MASK_WORDS + 1) * 4;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  return h ^ (h >> 16);
+}
+
+// The entry of a mask on a layer, or NULL
+static inline const struct chord_engine_entry *
+chord_engine_lookup(const struct chord_engine_entry *entries, size_t slots, const uint16_t *seeds,
+                    size_t buckets, const uint32_t *mask, uint8_t layer) {
+  uint16_t seed = seeds[chord_engine_hash(mask, layer, 0) % buckets];
+  const struct chord_engine_entry *entry = &entries[chord_engine_hash(mask, layer, seed) % slots];
+  if (entry->layer != layer) {
+    return NULL;
+  }
+  for (int i = 0; i < CHORD_ENGINE_MASK_WORDS; ++i) {
+    if (entry->mask[i] != mask[i]) {
+      return NULL;
+    }
+  }
+  return entry;
+}
+
+// Whether a chord of a layer, with candidate rows as above, holds every key
+// of the mask and more. Such a chord has the key at position too, so only
+// that key's candidates are seen.
+static inline bool chord_engine_grows(const struct chord_engine_entry *entries,
+                                      const uint16_t *rows, size_t positions,
+                                      const uint16_t *candidates, const uint32_t *mask,
+                                      uint32_t position) {
+  if (position >= positions) {
+    return false;
+  }
+  for (uint16_t i = rows[position]; i < rows[position + 1]; ++i) {
+    const struct chord_engine_entry *entry = &entries[candidates[i]];
+    bool covers = true;
+    bool larger = false;
+    for (int w = 0; w < CHORD_ENGINE_MASK_WORDS; ++w) {
+      covers = covers && (entry->mask[w] & mask[w]) == mask[w];
+      larger = larger || entry->mask[w] != mask[w];
+    }
+    if (covers && larger) {
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif // CUSTOM_BEHAVIOR_CHORD_ENGINE_DICT_H
@@ -0,0 +1,20 @@
+/*
+ * Generated from jocke_chords.json by chords/generate_zmk_chords.py
+ * DO NOT EDIT MANUALLY
+ *
+ * Sizes of the tables in chord_engine_table.h, without their data.
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H
+#define CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H
+
+// Most keys in one chord
+#define CHORD_ENGINE_MAX_KEYS 3
+
+// Key positions up to the last one in a chord
+#define CHORD_ENGINE_POSITIONS 75
+
+// Layers with chords
+#define CHORD_ENGINE_LAYERS 1
+
+#endif // CUSTOM_BEHAVIOR_CHORD_ENGINE_LIMITS_H
@@ -0,0 +1,57 @@
+/*
+ * Generated from jocke_chords.json by chords/generate_zmk_chords.py
+ * DO NOT EDIT MANUALLY
+ *
+ * Perfect hash of the word chords and their candidate index per layer and
+ * key position, see chord_engine_dict.h for the format.
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H
+#define CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H
+
+#include <stdint.h>
+
+#include "chord_engine_dict.h"
+#include "chord_engine_limits.h"
+
+static const struct chord_engine_layer chord_engine_layers[CHORD_ENGINE_LAYERS] = {
+    {{0x03000000, 0x08021F18, 0x00000400}, 0},
+};
+
+static const uint16_t chord_engine_seeds[] = {
+    2,
+};
+
+static const struct chord_engine_entry chord_engine_entries[] = {
+    {{0x00000000, 0x00001110, 0x00000000}, 0, 0, 2}, // more
+    {{0x02000000, 0x00000800, 0x00000400}, 0, 0, 3}, // if
+    {{0x01000000, 0x08000400, 0x00000000}, 0, 0, 0}, // when
+    {{0x00000000, 0x00020208, 0x00000000}, 0, 0, 1}, // can
+};
+
+static const uint16_t chord_engine_candidate_offsets[CHORD_ENGINE_LAYERS * CHORD_ENGINE_POSITIONS + 1] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 4, 4, 4, 4, 5, 6, 7, 8, 9, 9, 9,
+    9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 12,
+};
+
+static const uint16_t chord_engine_candidates[] = {
+    2, // Layer 0, 24
+    1, // Layer 0, 25
+    3, // Layer 0, 35
+    0, // Layer 0, 36
+    0, // Layer 0, 40
+    3, // Layer 0, 41
+    2, // Layer 0, 42
+    1, // Layer 0, 43
+    0, // Layer 0, 44
+    3, // Layer 0, 49
+    2, // Layer 0, 59
+    1, // Layer 0, 74
+};
+
+#endif // CUSTOM_BEHAVIOR_CHORD_ENGINE_TABLE_H
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_DICT_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_DICT_H
+
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+// Front-coded cycle list format, produced by
+// chords/generate_cycle_string_table.py.
+//
+// Strings are stored as Latin-1 text and only mapped to keystrokes when typed,
+// through the host layout table. All lists live back to back in one
+// read-only blob, and a list's entries are:
+//
+//   [prefix] [suffix length] suffix characters...
+//
+// where prefix is the number of leading characters shared with the previous
+// variant. The first variant has prefix 0 and is stored in full; the wrap
+// prefix is what it shares with the last variant, for cycling back to it.
+//
+// A cycle step from variant n - 1 to n types exactly the stored suffix of n.
+// Steps between any other two variants (CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE
+// reorders them) rebuild characters from the predecessors one at a time.
+
+#define CYCLE_STRING_ENTRY_HEADER_LEN 2
+
+// Where a list starts in the blob. Four bytes per list, no pointers.
+struct cycle_string_list {
+  uint16_t offset;     // Of the list's first entry in the blob
+  uint8_t len;         // Number of variants
+  uint8_t wrap_prefix; // Characters the first variant shares with the last
+};
+
+struct cycle_string_variant {
+  const uint8_t *suffix; // Characters after the shared prefix
+  uint8_t prefix;        // Characters shared with the previous variant
+  uint8_t suffix_len;
+};
+
+// Walk the entries of a list up to the requested variant
+static inline struct cycle_string_variant
+cycle_string_variant_get(const uint8_t *blob, const struct cycle_string_list *list,
+                         uint8_t index) {
+  const uint8_t *entry = blob + list->offset;
+  for (uint8_t i = 0; i < index; ++i) {
+    entry += CYCLE_STRING_ENTRY_HEADER_LEN + entry[1];
+  }
+  return (struct cycle_string_variant){
+      .suffix = entry + CYCLE_STRING_ENTRY_HEADER_LEN,
+      .prefix = entry[0],
+      .suffix_len = entry[1],
+  };
+}
+
+// Total characters of a variant
+static inline uint8_t cycle_string_variant_len(const struct cycle_string_variant *variant) {
+  return variant->prefix + variant->suffix_len;
+}
+
+// Character pos (within its length) of a variant. The first
+// prefix characters of a variant are those of the one before it, so walk the
+// list from its start and let every entry overwrite what its suffix covers.
+static inline uint8_t cycle_string_variant_char(const uint8_t *blob,
+                                                const struct cycle_string_list *list,
+                                                uint8_t index, uint8_t pos) {
+  const uint8_t *entry = blob + list->offset;
+  uint8_t c = 0;
+  for (uint8_t i = 0;; ++i) {
+    if (pos >= entry[0] && pos - entry[0] < entry[1]) {
+      c = entry[CYCLE_STRING_ENTRY_HEADER_LEN + pos - entry[0]];
+    }
+    if (i == index) {
+      return c;
+    }
+    entry += CYCLE_STRING_ENTRY_HEADER_LEN + entry[1];
+  }
+}
+
+// Leading characters two variants of a list have in common. Stepping forward
+// or wrapping around reads the stored prefix; other pairs compare characters.
+static inline uint8_t cycle_string_common_prefix(const uint8_t *blob,
+                                                 const struct cycle_string_list *list,
+                                                 uint8_t from, uint8_t to) {
+  if (to == from + 1) {
+    return cycle_string_variant_get(blob, list, to).prefix;
+  }
+  if (to == 0 && from == list->len - 1) {
+    return list->wrap_prefix;
+  }
+  struct cycle_string_variant a = cycle_string_variant_get(blob, list, from);
+  struct cycle_string_variant b = cycle_string_variant_get(blob, list, to);
+  uint8_t len = MIN(cycle_string_variant_len(&a), cycle_string_variant_len(&b));
+  uint8_t shared = 0;
+  while (shared < len && cycle_string_variant_char(blob, list, from, shared) ==
+                             cycle_string_variant_char(blob, list, to, shared)) {
+    ++shared;
+  }
+  return shared;
+}
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_DICT_H
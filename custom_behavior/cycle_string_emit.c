@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/endpoints.h> // For flushing reports in direct HID mode
+#include <zmk/event_manager.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/hid.h>
+#include <zmk/keys.h>
+
+#include "cycle_string_emit.h"
+#include "cycle_string_layout.h"
+#include "cycle_string_trace.h"
+
+// Raise one key transition as a keycode state changed event. Modifiers ride
+// along as implicit modifiers, like &kp LS(A), so a shifted character is two
+// events rather than four and is not affected by the Shift mask.
+static inline void raise_usage(uint32_t usage, uint8_t mods, bool state) {
+  struct zmk_keycode_state_changed event = {
+      .usage_page = HID_USAGE_KEY, // Assuming standard keyboard usage page
+      .keycode = usage,
+      .implicit_modifiers = mods,
+      .state = state,
+      .timestamp = k_uptime_get()};
+  int ret = raise_zmk_keycode_state_changed(event);
+  if (ret != 0) {
+    LOG_ERR("Failed to raise key %s event: %d", state ? "down" : "up", ret);
+  }
+}
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_EMIT_HID_DIRECT)
+
+// Write one key transition straight into the keyboard HID report and flush it
+// to the active endpoint. Modifiers are implicit ones, sharing the report with
+// the key, so a shifted character costs the same two reports as a plain one.
+// Nothing is dispatched through the event manager, so no listener (including
+// ours) runs.
+static inline void emit_usage(uint32_t usage, uint8_t mods, bool state) {
+  if (state) {
+    zmk_hid_implicit_modifiers_press(mods);
+    zmk_hid_keyboard_press(usage);
+  } else {
+    zmk_hid_keyboard_release(usage);
+    zmk_hid_implicit_modifiers_release();
+  }
+
+  int ret = zmk_endpoints_send_report(HID_USAGE_KEY);
+  if (ret != 0) {
+    LOG_ERR("Failed to send keyboard report: %d", ret);
+  }
+}
+
+#else
+
+static inline void emit_usage(uint32_t usage, uint8_t mods, bool state) {
+  raise_usage(usage, mods, state);
+}
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_EMIT_HID_DIRECT)
+
+// Let the matrix scan and combo engine run between keystrokes of a queued
+// burst. Inline bursts run on the caller's thread and never yield.
+static inline void emit_yield(void) {
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
+  k_yield();
+#endif
+}
+
+// Helper to tap a usage ID while holding a set of modifiers (MOD_* bits)
+static inline void tap_usage_mods(uint32_t usage, uint8_t mods) {
+  emit_usage(usage, mods, true);
+  emit_usage(usage, mods, false);
+  emit_yield();
+}
+
+// Type one character with the key the host layout produces it with
+static void type_char(uint8_t c) {
+  const struct cycle_string_layout_key *key = &cycle_string_layout[c];
+  if (key->usage == 0) {
+    LOG_ERR("No key for character 0x%02X in the host layout", c);
+    return;
+  }
+  tap_usage_mods(key->usage, key->mods);
+  if (key->dead) {
+    tap_usage_mods(HID_USAGE_KEY_KEYBOARD_SPACEBAR, 0);
+  }
+}
+
+// Upper case of a Latin-1 letter; anything else is returned as is
+static inline uint8_t latin1_upper(uint8_t c) {
+  if ((c >= 'a' && c <= 'z') || (c >= 0xE0 && c <= 0xFE && c != 0xF7)) {
+    return c - 0x20;
+  }
+  return c;
+}
+
+// Type the first character of a capitalized string, in lower case if the host
+// layout has no key for the upper case one
+static void type_capital(uint8_t c) {
+  uint8_t upper = latin1_upper(c);
+  if (cycle_string_layout[upper].usage != 0) {
+    c = upper;
+  }
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_EMIT_HID_DIRECT)
+  // A sticky Shift is released by the next keycode event past its listener,
+  // and reports written directly raise none, so it would capitalize the key
+  // after the string too. Raise the capital's own events then; it uses the
+  // sticky Shift up like a key typed by hand.
+  const struct cycle_string_layout_key *key = &cycle_string_layout[c];
+  if (key->usage != 0 && (zmk_hid_get_explicit_mods() & (MOD_LSFT | MOD_RSFT)) != 0) {
+    raise_usage(key->usage, key->mods, true);
+    raise_usage(key->usage, key->mods, false);
+    emit_yield();
+    if (key->dead) {
+      tap_usage_mods(HID_USAGE_KEY_KEYBOARD_SPACEBAR, 0);
+    }
+    return;
+  }
+#endif
+  type_char(c);
+}
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+
+// Whether the last key typed ended a sentence. Unknown at boot, so false.
+// Only touched from the event thread, never from the async work queue.
+static bool sentence_start;
+
+void cycle_string_emit_sentence(enum cycle_string_sentence sentence) {
+  if (sentence != CYCLE_STRING_SENTENCE_KEEPS) {
+    sentence_start = sentence == CYCLE_STRING_SENTENCE_ENDS;
+  }
+}
+
+#endif
+
+bool cycle_string_emit_capitalize(void) {
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+  if (sentence_start) {
+    // The string continues the sentence; the burst carries the capital
+    sentence_start = false;
+    return true;
+  }
+#endif
+  // A sticky Shift is registered as an explicit modifier until the next key
+  return (zmk_hid_get_explicit_mods() & (MOD_LSFT | MOD_RSFT)) != 0;
+}
+
+static void run_burst(const struct cycle_string_burst *burst) {
+  // A held Shift would turn the whole string into capitals. Mask it; the
+  // layout's own modifiers are implicit ones and get through.
+  if (burst->blob != NULL) {
+    zmk_hid_masked_modifiers_set(MOD_LSFT | MOD_RSFT);
+  }
+  for (uint8_t i = 0; i < burst->backspaces; ++i) {
+    tap_usage_mods(HID_USAGE_KEY_KEYBOARD_DELETE_BACKSPACE, 0);
+  }
+  if (burst->backspaces != 0) {
+    CYCLE_STRING_TRACE_END(CYCLE_STRING_TRACE_BACKSPACES, burst->trace_start);
+  }
+  if (burst->blob != NULL) {
+    struct cycle_string_variant variant =
+        cycle_string_variant_get(burst->blob, burst->list, burst->variant);
+    uint8_t len = cycle_string_variant_len(&variant);
+    // Leading backspaces of a type string come before its first character
+    bool capital = burst->capitalize && burst->skip == 0;
+    for (uint8_t pos = burst->skip; pos < len; ++pos) {
+      // A step to the next variant only types its stored suffix
+      uint8_t c = pos >= variant.prefix
+                      ? variant.suffix[pos - variant.prefix]
+                      : cycle_string_variant_char(burst->blob, burst->list, burst->variant, pos);
+      if (capital && c != '\b') {
+        type_capital(c);
+        capital = false;
+      } else {
+        type_char(c);
+      }
+    }
+    CYCLE_STRING_TRACE_END(CYCLE_STRING_TRACE_STRING, burst->trace_start);
+  }
+  if (burst->key.usage != 0) {
+    tap_usage_mods(burst->key.usage, burst->key.mods);
+  }
+  if (burst->space) {
+    tap_usage_mods(HID_USAGE_KEY_KEYBOARD_SPACEBAR, 0);
+  }
+  if (burst->blob != NULL) {
+    zmk_hid_masked_modifiers_clear();
+  }
+}
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
+
+// Registered by behavior_cycle_string.c; deferred events resume after it
+extern const struct zmk_listener zmk_listener_behavior_cycle_string;
+
+enum cycle_string_job_type {
+  CYCLE_STRING_JOB_BURST,
+  CYCLE_STRING_JOB_REPLAY,
+};
+
+struct cycle_string_job {
+  enum cycle_string_job_type type;
+  union {
+    struct cycle_string_burst burst;
+    struct zmk_keycode_state_changed_event replay;
+  };
+};
+
+K_MSGQ_DEFINE(cycle_string_jobs, sizeof(struct cycle_string_job),
+              CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC_QUEUE_SIZE, 4);
+
+K_THREAD_STACK_DEFINE(cycle_string_work_q_stack,
+                      CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC_STACK_SIZE);
+
+static struct k_work_q cycle_string_work_q;
+
+// Jobs queued or running. Raised before a job is queued and dropped once it
+// has been fully typed, so the listener never sees a gap between bursts.
+static atomic_t cycle_string_pending = ATOMIC_INIT(0);
+
+static void cycle_string_work_handler(struct k_work *work) {
+  struct cycle_string_job job;
+
+  while (k_msgq_get(&cycle_string_jobs, &job, K_NO_WAIT) == 0) {
+    if (job.type == CYCLE_STRING_JOB_BURST) {
+      run_burst(&job.burst);
+    } else {
+      ZMK_EVENT_RAISE_AFTER(job.replay, behavior_cycle_string);
+    }
+    atomic_dec(&cycle_string_pending);
+  }
+}
+
+static K_WORK_DEFINE(cycle_string_work, cycle_string_work_handler);
+
+static void enqueue_job(const struct cycle_string_job *job) {
+  atomic_inc(&cycle_string_pending);
+  // Wait rather than drop when the ring is full; the work queue thread is
+  // always draining it, so this only throttles an extreme burst of chords.
+  k_msgq_put(&cycle_string_jobs, job, K_FOREVER);
+  k_work_submit_to_queue(&cycle_string_work_q, &cycle_string_work);
+}
+
+void cycle_string_emit_burst(const struct cycle_string_burst *burst) {
+  struct cycle_string_job job = {.type = CYCLE_STRING_JOB_BURST, .burst = *burst};
+  enqueue_job(&job);
+}
+
+bool cycle_string_emit_busy(void) { return atomic_get(&cycle_string_pending) > 0; }
+
+bool cycle_string_emit_is_own(void) {
+  return k_current_get() == &cycle_string_work_q.thread;
+}
+
+int cycle_string_emit_defer(const struct zmk_keycode_state_changed *ev) {
+  struct cycle_string_job job = {.type = CYCLE_STRING_JOB_REPLAY,
+                                 .replay = copy_raised_zmk_keycode_state_changed(ev)};
+  enqueue_job(&job);
+  return ZMK_EV_EVENT_CAPTURED;
+}
+
+static int cycle_string_emit_init(void) {
+  // Same cooperative priority as the system work queue by default: a burst
+  // is never preempted in the middle of an event dispatch, and it yields
+  // between keystrokes so scanning and combos keep running.
+  static const struct k_work_queue_config config = {.name = "cycle_string"};
+  k_work_queue_init(&cycle_string_work_q);
+  k_work_queue_start(&cycle_string_work_q, cycle_string_work_q_stack,
+                     K_THREAD_STACK_SIZEOF(cycle_string_work_q_stack),
+                     CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC_PRIORITY, &config);
+  return 0;
+}
+
+SYS_INIT(cycle_string_emit_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#else
+
+// Set while an inline burst is typed, so the listener can tell the events it
+// raises from the user's own key presses
+static bool cycle_string_emitting;
+
+void cycle_string_emit_burst(const struct cycle_string_burst *burst) {
+  cycle_string_emitting = true;
+  run_burst(burst);
+  cycle_string_emitting = false;
+}
+
+bool cycle_string_emit_is_own(void) { return cycle_string_emitting; }
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
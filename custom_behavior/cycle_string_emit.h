@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_EMIT_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_EMIT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+#include <zmk/events/keycode_state_changed.h>
+
+#include "cycle_string_dict.h"
+
+// One keystroke: HID keyboard usage plus the modifiers held while tapping it
+struct cycle_string_key {
+  uint8_t usage;
+  uint8_t mods;
+};
+
+// Everything typed in one go: backspaces, then a variant of a cycle list (or a
+// type string, a single-variant list), then an optional single extra key, then
+// an optional trailing space. The variant is decoded from the const table while
+// typing and each Latin-1 character goes through the host layout table
+// (cycle_string_layout.h).
+struct cycle_string_burst {
+  const uint8_t *blob;                  // Table blob, NULL for no variant
+  const struct cycle_string_list *list; // Points into const table data
+  uint8_t variant;
+  uint8_t skip; // Leading characters of the variant still on screen
+  bool capitalize; // Type the variant's first character in upper case
+  uint8_t backspaces;
+  struct cycle_string_key key; // Extra key, usage 0 means none
+  bool space;
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_TRACE)
+  uint32_t trace_start; // Cycle count when the burst was made
+#endif
+};
+
+// Type a burst. With CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC this queues it for
+// the dedicated work queue and returns immediately; otherwise it types inline.
+void cycle_string_emit_burst(const struct cycle_string_burst *burst);
+
+// Whether a string started now should be capitalized: Shift is held or a
+// sticky Shift is pending, or with CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE
+// the last key typed ended a sentence. Called once per string, when its burst
+// is made: the string uses the sentence start up.
+bool cycle_string_emit_capitalize(void);
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE)
+
+// What a key pressed by the user does to the sentence. Strings the emitter
+// types always continue it.
+enum cycle_string_sentence {
+  CYCLE_STRING_SENTENCE_CONTINUES,
+  CYCLE_STRING_SENTENCE_ENDS,
+  CYCLE_STRING_SENTENCE_KEEPS, // Neither, e.g. Space or a modifier
+};
+
+void cycle_string_emit_sentence(enum cycle_string_sentence sentence);
+
+#endif
+
+// True for keycode events the emitter itself raised: from its own work queue
+// thread with CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC, otherwise while an
+// inline burst is being typed
+bool cycle_string_emit_is_own(void);
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
+
+// True while bursts are queued or being typed
+bool cycle_string_emit_busy(void);
+
+// Capture a keycode event that arrived while busy and re-raise it after the
+// pending bursts, so it is neither dropped nor interleaved with them
+int cycle_string_emit_defer(const struct zmk_keycode_state_changed *ev);
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_EMIT_H
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/crc.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "behavior_cycle_string.h"
+#include "cycle_string_emit.h"
+#include "cycle_string_flash_dict.h"
+#include "cycle_string_stats.h"
+#include "cycle_string_tables.h"
+#include "cycle_string_usage.h"
+
+// The dictionary lives in its own partition of the internal flash, which is
+// memory mapped: the tables of a loaded image point straight into it.
+// Uploading goes over the "cycle_str dict" shell commands, so it takes no
+// reboot and no firmware build.
+
+#if !FIXED_PARTITION_EXISTS(cycle_string_partition)
+#error "CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT needs a cycle_string_partition in the devicetree"
+#endif
+
+BUILD_ASSERT(!IS_ENABLED(CONFIG_BIG_ENDIAN), "dictionary images are little-endian");
+
+#define DICT_PARTITION_ID FIXED_PARTITION_ID(cycle_string_partition)
+#define DICT_PARTITION_SIZE FIXED_PARTITION_SIZE(cycle_string_partition)
+#define DICT_IMAGE                                                                                 \
+  ((const uint8_t *)(CONFIG_FLASH_BASE_ADDRESS + FIXED_PARTITION_OFFSET(cycle_string_partition)))
+
+// Bytes a write command takes at most, as hex on one shell line
+#define DICT_WRITE_MAX 128
+
+static const uint16_t empty_seeds[1];
+static const uint16_t empty_offsets[1];
+static const struct chord_engine_entry empty_entries[1] = {{.layer = CHORD_ENGINE_NO_LAYER}};
+
+// Nothing to type and no layer with chords, while the partition is rewritten
+static const struct cycle_string_tables empty = {
+    .usage_base = empty_offsets,
+    .chord_seeds = empty_seeds,
+    .chord_buckets = 1,
+    .chord_entries = empty_entries,
+    .chord_slots = 1,
+    .chord_offsets = empty_offsets,
+    .chord_max_keys = 1,
+};
+
+static struct cycle_string_tables loaded;
+
+// Changed on the system work queue only, where the behaviors and the chord
+// engine read it, so a switch never lands in the middle of a key event
+static const struct cycle_string_tables *active = &cycle_string_builtin_tables;
+static const struct cycle_string_tables *next;
+// Of the lists the usage counts and stats were counted for
+static uint32_t counted_crc;
+
+const struct cycle_string_tables *cycle_string_tables_get(void) { return active; }
+
+static void switch_work_handler(struct k_work *work) {
+  // Sequences in progress count against the lists they were typed from
+  cycle_string_end_sequences();
+  active = next;
+  if (active != &empty && active->crc != counted_crc) {
+    counted_crc = active->crc;
+    cycle_string_usage_reset();
+    cycle_string_stats_reset();
+  }
+}
+
+static K_WORK_DEFINE(switch_work, switch_work_handler);
+
+// Switch tables from the shell thread and wait until it is done
+static void switch_to(const struct cycle_string_tables *tables) {
+  struct k_work_sync sync;
+  next = tables;
+  k_work_submit(&switch_work);
+  k_work_flush(&switch_work, &sync);
+}
+
+// Stop reading the partition before it is erased or written: switch to the
+// empty tables and let strings already queued from it finish typing
+static void suspend(void) {
+  switch_to(&empty);
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC)
+  while (cycle_string_emit_busy()) {
+    k_sleep(K_MSEC(10));
+  }
+#endif
+}
+
+// A section as whole elements of size bytes, or NULL if it is misaligned or
+// not inside the image
+static const void *section(const struct cycle_string_flash_dict_header *header,
+                           enum cycle_string_flash_dict_section id, size_t size, size_t *count) {
+  const struct cycle_string_flash_dict_section_ref *ref = &header->sections[id];
+  if (ref->offset % 4 != 0 || ref->offset < sizeof(*header) || ref->offset > header->size ||
+      ref->len > header->size - ref->offset || ref->len % size != 0 ||
+      ref->len / size > UINT16_MAX) {
+    return NULL;
+  }
+  *count = ref->len / size;
+  return DICT_IMAGE + ref->offset;
+}
+
+// Whether every list decodes inside its blob, as cycle_string_dict.h walks it
+static bool lists_valid(const uint8_t *blob, size_t blob_len,
+                        const struct cycle_string_list *lists, size_t count, uint8_t max_len) {
+  for (size_t i = 0; i < count; ++i) {
+    if (lists[i].len == 0 || lists[i].len > max_len) {
+      return false;
+    }
+    size_t pos = lists[i].offset;
+    unsigned previous = 0;
+    unsigned first = 0;
+    for (uint8_t v = 0; v < lists[i].len; ++v) {
+      if (pos + CYCLE_STRING_ENTRY_HEADER_LEN > blob_len) {
+        return false;
+      }
+      unsigned len = blob[pos] + blob[pos + 1];
+      if ((v == 0 && blob[pos] != 0) || blob[pos] > previous || len > UINT8_MAX) {
+        return false;
+      }
+      pos += CYCLE_STRING_ENTRY_HEADER_LEN + blob[pos + 1];
+      if (pos > blob_len) {
+        return false;
+      }
+      first = v == 0 ? len : first;
+      previous = len;
+    }
+    if (lists[i].wrap_prefix > MIN(first, previous)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Point tables into the image in the partition, or say what is wrong with it
+static const char *parse(struct cycle_string_tables *tables) {
+  const struct cycle_string_flash_dict_header *header = (const void *)DICT_IMAGE;
+  if (header->magic != CYCLE_STRING_FLASH_DICT_MAGIC) {
+    return "no dictionary";
+  }
+  if (header->version != CYCLE_STRING_FLASH_DICT_VERSION) {
+    return "unsupported version";
+  }
+  if (header->size < sizeof(*header) || header->size > DICT_PARTITION_SIZE) {
+    return "bad size";
+  }
+  if (crc32_ieee(DICT_IMAGE + sizeof(*header), header->size - sizeof(*header)) != header->crc) {
+    return "bad checksum";
+  }
+
+  size_t blob_len, lists_len;
+  *tables = (struct cycle_string_tables){.crc = header->table_crc};
+  tables->cycle_blob = section(header, CYCLE_STRING_FLASH_DICT_CYCLE_BLOB, 1, &blob_len);
+  tables->cycle_lists = section(header, CYCLE_STRING_FLASH_DICT_CYCLE_LISTS,
+                                sizeof(struct cycle_string_list), &lists_len);
+  if (tables->cycle_blob == NULL || tables->cycle_lists == NULL ||
+      !lists_valid(tables->cycle_blob, blob_len, tables->cycle_lists, lists_len,
+                   CYCLE_STRING_VARIANTS_CAPACITY)) {
+    return "bad cycle lists";
+  }
+  tables->cycle_lists_len = lists_len;
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)
+  size_t bases;
+  tables->usage_base =
+      section(header, CYCLE_STRING_FLASH_DICT_USAGE_BASE, sizeof(uint16_t), &bases);
+  if (tables->usage_base == NULL || bases != lists_len + 1) {
+    return "bad usage counters";
+  }
+  for (size_t i = 0; i < lists_len; ++i) {
+    if (tables->usage_base[i] > tables->usage_base[i + 1]) {
+      return "bad usage counters";
+    }
+  }
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_TYPE_STRING) || IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+  size_t type_blob_len, strings_len;
+  tables->type_blob = section(header, CYCLE_STRING_FLASH_DICT_TYPE_BLOB, 1, &type_blob_len);
+  tables->type_strings = section(header, CYCLE_STRING_FLASH_DICT_TYPE_STRINGS,
+                                 sizeof(struct cycle_string_list), &strings_len);
+  if (tables->type_blob == NULL || tables->type_strings == NULL ||
+      !lists_valid(tables->type_blob, type_blob_len, tables->type_strings, strings_len, 1)) {
+    return "bad type strings";
+  }
+  tables->type_strings_len = strings_len;
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+  size_t buckets, slots, offsets, candidates, layers;
+  tables->chord_seeds =
+      section(header, CYCLE_STRING_FLASH_DICT_CHORD_SEEDS, sizeof(uint16_t), &buckets);
+  tables->chord_entries = section(header, CYCLE_STRING_FLASH_DICT_CHORD_ENTRIES,
+                                  sizeof(struct chord_engine_entry), &slots);
+  tables->chord_offsets =
+      section(header, CYCLE_STRING_FLASH_DICT_CHORD_OFFSETS, sizeof(uint16_t), &offsets);
+  tables->chord_candidates =
+      section(header, CYCLE_STRING_FLASH_DICT_CHORD_CANDIDATES, sizeof(uint16_t), &candidates);
+  tables->chord_layers = section(header, CYCLE_STRING_FLASH_DICT_CHORD_LAYERS,
+                                 sizeof(struct chord_engine_layer), &layers);
+  if (tables->chord_seeds == NULL || tables->chord_entries == NULL ||
+      tables->chord_offsets == NULL || tables->chord_candidates == NULL ||
+      tables->chord_layers == NULL || buckets == 0 || slots == 0 || layers == 0 ||
+      layers > UINT8_MAX || offsets == 0 || (offsets - 1) % layers != 0 ||
+      header->chord_max_keys == 0 || header->chord_max_keys > CHORD_ENGINE_KEYS_CAPACITY) {
+    return "bad chords";
+  }
+  for (size_t i = 0; i < slots; ++i) {
+    if (tables->chord_entries[i].layer != CHORD_ENGINE_NO_LAYER &&
+        tables->chord_entries[i].string >= strings_len) {
+      return "bad chords";
+    }
+  }
+  for (size_t i = 0; i + 1 < offsets; ++i) {
+    if (tables->chord_offsets[i] > tables->chord_offsets[i + 1]) {
+      return "bad chord index";
+    }
+  }
+  if (tables->chord_offsets[offsets - 1] != candidates) {
+    return "bad chord index";
+  }
+  for (size_t i = 0; i < candidates; ++i) {
+    if (tables->chord_candidates[i] >= slots) {
+      return "bad chord index";
+    }
+  }
+  tables->chord_buckets = buckets;
+  tables->chord_slots = slots;
+  tables->chord_positions = (offsets - 1) / layers;
+  tables->chord_layers_len = layers;
+  tables->chord_max_keys = header->chord_max_keys;
+#endif
+  return NULL;
+}
+
+static int flash_dict_init(void) {
+  const char *err = parse(&loaded);
+  if (err == NULL) {
+    active = &loaded;
+    LOG_INF("Cycle string dictionary loaded from flash, %u lists", loaded.cycle_lists_len);
+  } else {
+    LOG_INF("Cycle string dictionary not loaded (%s), using the built-in tables", err);
+  }
+  counted_crc = active->crc;
+  return 0;
+}
+
+// After the flash driver, before settings restore the usage counts
+SYS_INIT(flash_dict_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static int cmd_info(const struct shell *sh, size_t argc, char **argv) {
+  const struct cycle_string_tables *tables = active;
+  const char *source = tables == &loaded                        ? "uploaded"
+                       : tables == &cycle_string_builtin_tables ? "built-in"
+                                                                : "none, upload in progress";
+  shell_print(sh, "Dictionary: %s, partition %u bytes", source, (unsigned)DICT_PARTITION_SIZE);
+  shell_print(sh, "Lists: %u, type strings: %u, chord slots: %u, checksum: %08x",
+              tables->cycle_lists_len, tables->type_strings_len,
+              tables == &empty ? 0 : tables->chord_slots, tables->crc);
+  return 0;
+}
+
+static int cmd_erase(const struct shell *sh, size_t argc, char **argv) {
+  unsigned long size = strtoul(argv[1], NULL, 0);
+  if (size == 0 || size > DICT_PARTITION_SIZE) {
+    shell_error(sh, "Size must be 1 to %u bytes", (unsigned)DICT_PARTITION_SIZE);
+    return -EINVAL;
+  }
+  const struct flash_area *fa;
+  int err = flash_area_open(DICT_PARTITION_ID, &fa);
+  if (err < 0) {
+    shell_error(sh, "Cannot open the dictionary partition (%d)", err);
+    return err;
+  }
+  suspend();
+  // Erase whole pages, up to the one holding the last byte
+  struct flash_pages_info page;
+  err = flash_get_page_info_by_offs(flash_area_get_device(fa), fa->fa_off + size - 1, &page);
+  if (err == 0) {
+    err = flash_area_erase(fa, 0, page.start_offset + page.size - fa->fa_off);
+  }
+  flash_area_close(fa);
+  if (err < 0) {
+    shell_error(sh, "Erase failed (%d)", err);
+    return err;
+  }
+  shell_print(sh, "Dictionary erased, typing strings is off until it is loaded");
+  return 0;
+}
+
+// Quiet on success: the uploader sends hundreds of these
+static int cmd_write(const struct shell *sh, size_t argc, char **argv) {
+  if (active != &empty) {
+    shell_error(sh, "Erase the dictionary first");
+    return -EBUSY;
+  }
+  unsigned long offset = strtoul(argv[1], NULL, 0);
+  uint8_t data[DICT_WRITE_MAX];
+  size_t len = hex2bin(argv[2], strlen(argv[2]), data, sizeof(data));
+  if (len == 0 || offset > DICT_PARTITION_SIZE || len > DICT_PARTITION_SIZE - offset) {
+    shell_error(sh, "Expected an offset and up to %u bytes of hex inside the partition",
+                DICT_WRITE_MAX);
+    return -EINVAL;
+  }
+  const struct flash_area *fa;
+  int err = flash_area_open(DICT_PARTITION_ID, &fa);
+  if (err < 0) {
+    shell_error(sh, "Cannot open the dictionary partition (%d)", err);
+    return err;
+  }
+  uint32_t align = flash_area_align(fa);
+  if (offset % align != 0 || len % align != 0) {
+    err = -EINVAL;
+    shell_error(sh, "Writes must be aligned to %u bytes", align);
+  } else {
+    err = flash_area_write(fa, offset, data, len);
+    if (err < 0) {
+      shell_error(sh, "Write failed (%d)", err);
+    }
+  }
+  flash_area_close(fa);
+  return err;
+}
+
+static int cmd_load(const struct shell *sh, size_t argc, char **argv) {
+  suspend();
+  const char *err = parse(&loaded);
+  if (err != NULL) {
+    switch_to(&cycle_string_builtin_tables);
+    shell_error(sh, "Dictionary rejected: %s, using the built-in tables", err);
+    return -EINVAL;
+  }
+  switch_to(&loaded);
+  shell_print(sh, "Dictionary loaded: %u lists, %u type strings, checksum %08x",
+              loaded.cycle_lists_len, loaded.type_strings_len, loaded.crc);
+  return 0;
+}
+
+static int cmd_clear(const struct shell *sh, size_t argc, char **argv) {
+  const struct flash_area *fa;
+  int err = flash_area_open(DICT_PARTITION_ID, &fa);
+  if (err < 0) {
+    shell_error(sh, "Cannot open the dictionary partition (%d)", err);
+    return err;
+  }
+  suspend();
+  // Erasing the page with the header is enough to never load it again
+  struct flash_pages_info page;
+  err = flash_get_page_info_by_offs(flash_area_get_device(fa), fa->fa_off, &page);
+  if (err == 0) {
+    err = flash_area_erase(fa, 0, page.size);
+  }
+  flash_area_close(fa);
+  switch_to(&cycle_string_builtin_tables);
+  if (err < 0) {
+    shell_error(sh, "Erase failed (%d)", err);
+    return err;
+  }
+  shell_print(sh, "Dictionary cleared, using the built-in tables");
+  return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+    dict_cmds, SHELL_CMD(info, NULL, "Show which dictionary is in use", cmd_info),
+    SHELL_CMD_ARG(erase, NULL, "<size> Erase room for an upload", cmd_erase, 2, 0),
+    SHELL_CMD_ARG(write, NULL, "<offset> <hex> Write part of an upload", cmd_write, 3, 0),
+    SHELL_CMD(load, NULL, "Check the upload and type from it", cmd_load),
+    SHELL_CMD(clear, NULL, "Erase the upload and go back to the built-in tables", cmd_clear),
+    SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((cycle_str), dict, &dict_cmds,
+                 "Upload a dictionary (see chords/upload_dictionary.py)", NULL, 1, 0);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_FLASH_DICT_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_FLASH_DICT_H
+
+#include <stdint.h>
+
+// Dictionary image format, built and uploaded by chords/upload_dictionary.py.
+//
+// An image is this header followed by its sections. Each section is one of
+// the generated tables exactly as the firmware reads it (little-endian, the
+// structs of cycle_string_dict.h and chord_engine_dict.h), so a loaded image
+// is used where it lies in flash. Sections start 4-byte aligned, located by
+// their offset from the start of the image, and the CRC covers everything
+// after the header. A new version changes the layout; the firmware only
+// loads the version it was built for.
+
+#define CYCLE_STRING_FLASH_DICT_MAGIC 0x54434944u // "DICT"
+#define CYCLE_STRING_FLASH_DICT_VERSION 2
+
+enum cycle_string_flash_dict_section {
+  CYCLE_STRING_FLASH_DICT_CYCLE_BLOB,       // uint8_t, as cycle_string_blob
+  CYCLE_STRING_FLASH_DICT_CYCLE_LISTS,      // struct cycle_string_list, as all_cycle_lists
+  CYCLE_STRING_FLASH_DICT_USAGE_BASE,       // uint16_t, one per list plus one
+  CYCLE_STRING_FLASH_DICT_TYPE_BLOB,        // uint8_t, as type_string_blob
+  CYCLE_STRING_FLASH_DICT_TYPE_STRINGS,     // struct cycle_string_list, as type_strings
+  CYCLE_STRING_FLASH_DICT_CHORD_SEEDS,      // uint16_t, one per hash bucket
+  CYCLE_STRING_FLASH_DICT_CHORD_ENTRIES,    // struct chord_engine_entry, one per slot
+  CYCLE_STRING_FLASH_DICT_CHORD_OFFSETS,    // uint16_t, per layer one per key position, plus one
+  CYCLE_STRING_FLASH_DICT_CHORD_CANDIDATES, // uint16_t, entry slots
+  CYCLE_STRING_FLASH_DICT_CHORD_LAYERS,     // struct chord_engine_layer, one per layer with chords
+  CYCLE_STRING_FLASH_DICT_SECTIONS,
+};
+
+struct cycle_string_flash_dict_section_ref {
+  uint32_t offset;
+  uint32_t len; // In bytes
+};
+
+struct cycle_string_flash_dict_header {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t chord_max_keys; // Most keys in one chord
+  uint8_t reserved;
+  uint32_t size;      // Of the whole image, header included
+  uint32_t crc;       // CRC-32 (IEEE) of the image after the header
+  uint32_t table_crc; // Of the cycle lists, as CYCLE_STRING_TABLE_CRC
+  struct cycle_string_flash_dict_section_ref sections[CYCLE_STRING_FLASH_DICT_SECTIONS];
+};
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_FLASH_DICT_H
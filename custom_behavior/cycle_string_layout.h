@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_LAYOUT_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_LAYOUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <dt-bindings/zmk/hid_usage.h>
+#include <dt-bindings/zmk/modifiers.h>
+#include <zephyr/sys/util.h>
+
+// How the host's keyboard layout types one character
+struct cycle_string_layout_key {
+  uint8_t usage; // 0 when the layout has no key for the character
+  uint8_t mods;
+  bool dead; // Dead key: needs a space after it to type the character itself
+};
+
+#define LAYOUT_KEY(usage, mods, dead) {HID_USAGE_KEY_KEYBOARD_##usage, mods, dead}
+#define LAYOUT_PLAIN(usage) LAYOUT_KEY(usage, 0, false)
+#define LAYOUT_SHIFT(usage) LAYOUT_KEY(usage, MOD_LSFT, false)
+#define LAYOUT_ALTGR(usage) LAYOUT_KEY(usage, MOD_RALT, false)
+#define LAYOUT_ALTGR_SHIFT(usage) LAYOUT_KEY(usage, MOD_RALT | MOD_LSFT, false)
+#define LAYOUT_DEAD(usage) LAYOUT_KEY(usage, 0, true)
+#define LAYOUT_DEAD_SHIFT(usage) LAYOUT_KEY(usage, MOD_LSFT, true)
+#define LAYOUT_DEAD_ALTGR(usage) LAYOUT_KEY(usage, MOD_RALT, true)
+
+// Letters, digits, whitespace and Backspace sit on the same keys in every
+// supported layout, except that some layouts swap Y and Z
+#define CYCLE_STRING_LAYOUT_ALNUM(y, z)                                       \
+  ['a'] = LAYOUT_PLAIN(A), ['A'] = LAYOUT_SHIFT(A),                           \
+  ['b'] = LAYOUT_PLAIN(B), ['B'] = LAYOUT_SHIFT(B),                           \
+  ['c'] = LAYOUT_PLAIN(C), ['C'] = LAYOUT_SHIFT(C),                           \
+  ['d'] = LAYOUT_PLAIN(D), ['D'] = LAYOUT_SHIFT(D),                           \
+  ['e'] = LAYOUT_PLAIN(E), ['E'] = LAYOUT_SHIFT(E),                           \
+  ['f'] = LAYOUT_PLAIN(F), ['F'] = LAYOUT_SHIFT(F),                           \
+  ['g'] = LAYOUT_PLAIN(G), ['G'] = LAYOUT_SHIFT(G),                           \
+  ['h'] = LAYOUT_PLAIN(H), ['H'] = LAYOUT_SHIFT(H),                           \
+  ['i'] = LAYOUT_PLAIN(I), ['I'] = LAYOUT_SHIFT(I),                           \
+  ['j'] = LAYOUT_PLAIN(J), ['J'] = LAYOUT_SHIFT(J),                           \
+  ['k'] = LAYOUT_PLAIN(K), ['K'] = LAYOUT_SHIFT(K),                           \
+  ['l'] = LAYOUT_PLAIN(L), ['L'] = LAYOUT_SHIFT(L),                           \
+  ['m'] = LAYOUT_PLAIN(M), ['M'] = LAYOUT_SHIFT(M),                           \
+  ['n'] = LAYOUT_PLAIN(N), ['N'] = LAYOUT_SHIFT(N),                           \
+  ['o'] = LAYOUT_PLAIN(O), ['O'] = LAYOUT_SHIFT(O),                           \
+  ['p'] = LAYOUT_PLAIN(P), ['P'] = LAYOUT_SHIFT(P),                           \
+  ['q'] = LAYOUT_PLAIN(Q), ['Q'] = LAYOUT_SHIFT(Q),                           \
+  ['r'] = LAYOUT_PLAIN(R), ['R'] = LAYOUT_SHIFT(R),                           \
+  ['s'] = LAYOUT_PLAIN(S), ['S'] = LAYOUT_SHIFT(S),                           \
+  ['t'] = LAYOUT_PLAIN(T), ['T'] = LAYOUT_SHIFT(T),                           \
+  ['u'] = LAYOUT_PLAIN(U), ['U'] = LAYOUT_SHIFT(U),                           \
+  ['v'] = LAYOUT_PLAIN(V), ['V'] = LAYOUT_SHIFT(V),                           \
+  ['w'] = LAYOUT_PLAIN(W), ['W'] = LAYOUT_SHIFT(W),                           \
+  ['x'] = LAYOUT_PLAIN(X), ['X'] = LAYOUT_SHIFT(X),                           \
+  ['y'] = LAYOUT_PLAIN(y), ['Y'] = LAYOUT_SHIFT(y),                           \
+  ['z'] = LAYOUT_PLAIN(z), ['Z'] = LAYOUT_SHIFT(z),                           \
+  ['1'] = LAYOUT_PLAIN(1_AND_EXCLAMATION),                                    \
+  ['2'] = LAYOUT_PLAIN(2_AND_AT),                                             \
+  ['3'] = LAYOUT_PLAIN(3_AND_HASH),                                           \
+  ['4'] = LAYOUT_PLAIN(4_AND_DOLLAR),                                         \
+  ['5'] = LAYOUT_PLAIN(5_AND_PERCENT),                                        \
+  ['6'] = LAYOUT_PLAIN(6_AND_CARET),                                          \
+  ['7'] = LAYOUT_PLAIN(7_AND_AMPERSAND),                                      \
+  ['8'] = LAYOUT_PLAIN(8_AND_ASTERISK),                                       \
+  ['9'] = LAYOUT_PLAIN(9_AND_LEFT_PARENTHESIS),                               \
+  ['0'] = LAYOUT_PLAIN(0_AND_RIGHT_PARENTHESIS),                              \
+  [' '] = LAYOUT_PLAIN(SPACEBAR),                                             \
+  ['\b'] = LAYOUT_PLAIN(DELETE_BACKSPACE),                                    \
+  ['\t'] = LAYOUT_PLAIN(TAB),                                                 \
+  ['\n'] = LAYOUT_PLAIN(RETURN_ENTER)
+
+// Character -> keystroke for the host layout picked in Kconfig, indexed by
+// Latin-1 code point. The cycle lists store Latin-1 text, so typing one
+// character is a single indexed load whatever the layout. Layouts are the
+// Windows/Linux variants; macOS swaps a few ISO keys.
+static const struct cycle_string_layout_key cycle_string_layout[256] = {
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_SE)
+    // Swedish
+    CYCLE_STRING_LAYOUT_ALNUM(Y, Z),
+    ['!'] = LAYOUT_SHIFT(1_AND_EXCLAMATION),
+    ['"'] = LAYOUT_SHIFT(2_AND_AT),
+    ['#'] = LAYOUT_SHIFT(3_AND_HASH),
+    [0xA4] = LAYOUT_SHIFT(4_AND_DOLLAR), // ¤
+    ['%'] = LAYOUT_SHIFT(5_AND_PERCENT),
+    ['&'] = LAYOUT_SHIFT(6_AND_CARET),
+    ['/'] = LAYOUT_SHIFT(7_AND_AMPERSAND),
+    ['('] = LAYOUT_SHIFT(8_AND_ASTERISK),
+    [')'] = LAYOUT_SHIFT(9_AND_LEFT_PARENTHESIS),
+    ['='] = LAYOUT_SHIFT(0_AND_RIGHT_PARENTHESIS),
+    ['@'] = LAYOUT_ALTGR(2_AND_AT),
+    [0xA3] = LAYOUT_ALTGR(3_AND_HASH), // £
+    ['$'] = LAYOUT_ALTGR(4_AND_DOLLAR),
+    ['{'] = LAYOUT_ALTGR(7_AND_AMPERSAND),
+    ['['] = LAYOUT_ALTGR(8_AND_ASTERISK),
+    [']'] = LAYOUT_ALTGR(9_AND_LEFT_PARENTHESIS),
+    ['}'] = LAYOUT_ALTGR(0_AND_RIGHT_PARENTHESIS),
+    ['+'] = LAYOUT_PLAIN(MINUS_AND_UNDERSCORE),
+    ['?'] = LAYOUT_SHIFT(MINUS_AND_UNDERSCORE),
+    ['\\'] = LAYOUT_ALTGR(MINUS_AND_UNDERSCORE),
+    [0xB4] = LAYOUT_DEAD(EQUAL_AND_PLUS), // ´
+    ['`'] = LAYOUT_DEAD_SHIFT(EQUAL_AND_PLUS),
+    [0xE5] = LAYOUT_PLAIN(LEFT_BRACKET_AND_LEFT_BRACE), // å
+    [0xC5] = LAYOUT_SHIFT(LEFT_BRACKET_AND_LEFT_BRACE), // Å
+    [0xA8] = LAYOUT_DEAD(RIGHT_BRACKET_AND_RIGHT_BRACE), // ¨
+    ['^'] = LAYOUT_DEAD_SHIFT(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['~'] = LAYOUT_DEAD_ALTGR(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['\''] = LAYOUT_PLAIN(BACKSLASH_AND_PIPE),
+    ['*'] = LAYOUT_SHIFT(BACKSLASH_AND_PIPE),
+    [0xF6] = LAYOUT_PLAIN(SEMICOLON_AND_COLON), // ö
+    [0xD6] = LAYOUT_SHIFT(SEMICOLON_AND_COLON), // Ö
+    [0xE4] = LAYOUT_PLAIN(APOSTROPHE_AND_QUOTE), // ä
+    [0xC4] = LAYOUT_SHIFT(APOSTROPHE_AND_QUOTE), // Ä
+    [0xA7] = LAYOUT_PLAIN(GRAVE_ACCENT_AND_TILDE), // §
+    [0xBD] = LAYOUT_SHIFT(GRAVE_ACCENT_AND_TILDE), // ½
+    ['<'] = LAYOUT_PLAIN(NON_US_BACKSLASH_AND_PIPE),
+    ['>'] = LAYOUT_SHIFT(NON_US_BACKSLASH_AND_PIPE),
+    ['|'] = LAYOUT_ALTGR(NON_US_BACKSLASH_AND_PIPE),
+    [','] = LAYOUT_PLAIN(COMMA_AND_LESS_THAN),
+    [';'] = LAYOUT_SHIFT(COMMA_AND_LESS_THAN),
+    ['.'] = LAYOUT_PLAIN(PERIOD_AND_GREATER_THAN),
+    [':'] = LAYOUT_SHIFT(PERIOD_AND_GREATER_THAN),
+    ['-'] = LAYOUT_PLAIN(SLASH_AND_QUESTION_MARK),
+    ['_'] = LAYOUT_SHIFT(SLASH_AND_QUESTION_MARK),
+    [0xB5] = LAYOUT_ALTGR(M), // µ
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US)
+    // US (ANSI)
+    CYCLE_STRING_LAYOUT_ALNUM(Y, Z),
+    ['!'] = LAYOUT_SHIFT(1_AND_EXCLAMATION),
+    ['@'] = LAYOUT_SHIFT(2_AND_AT),
+    ['#'] = LAYOUT_SHIFT(3_AND_HASH),
+    ['$'] = LAYOUT_SHIFT(4_AND_DOLLAR),
+    ['%'] = LAYOUT_SHIFT(5_AND_PERCENT),
+    ['^'] = LAYOUT_SHIFT(6_AND_CARET),
+    ['&'] = LAYOUT_SHIFT(7_AND_AMPERSAND),
+    ['*'] = LAYOUT_SHIFT(8_AND_ASTERISK),
+    ['('] = LAYOUT_SHIFT(9_AND_LEFT_PARENTHESIS),
+    [')'] = LAYOUT_SHIFT(0_AND_RIGHT_PARENTHESIS),
+    ['-'] = LAYOUT_PLAIN(MINUS_AND_UNDERSCORE),
+    ['_'] = LAYOUT_SHIFT(MINUS_AND_UNDERSCORE),
+    ['='] = LAYOUT_PLAIN(EQUAL_AND_PLUS),
+    ['+'] = LAYOUT_SHIFT(EQUAL_AND_PLUS),
+    ['['] = LAYOUT_PLAIN(LEFT_BRACKET_AND_LEFT_BRACE),
+    ['{'] = LAYOUT_SHIFT(LEFT_BRACKET_AND_LEFT_BRACE),
+    [']'] = LAYOUT_PLAIN(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['}'] = LAYOUT_SHIFT(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['\\'] = LAYOUT_PLAIN(BACKSLASH_AND_PIPE),
+    ['|'] = LAYOUT_SHIFT(BACKSLASH_AND_PIPE),
+    [';'] = LAYOUT_PLAIN(SEMICOLON_AND_COLON),
+    [':'] = LAYOUT_SHIFT(SEMICOLON_AND_COLON),
+    ['\''] = LAYOUT_PLAIN(APOSTROPHE_AND_QUOTE),
+    ['"'] = LAYOUT_SHIFT(APOSTROPHE_AND_QUOTE),
+    ['`'] = LAYOUT_PLAIN(GRAVE_ACCENT_AND_TILDE),
+    ['~'] = LAYOUT_SHIFT(GRAVE_ACCENT_AND_TILDE),
+    [','] = LAYOUT_PLAIN(COMMA_AND_LESS_THAN),
+    ['<'] = LAYOUT_SHIFT(COMMA_AND_LESS_THAN),
+    ['.'] = LAYOUT_PLAIN(PERIOD_AND_GREATER_THAN),
+    ['>'] = LAYOUT_SHIFT(PERIOD_AND_GREATER_THAN),
+    ['/'] = LAYOUT_PLAIN(SLASH_AND_QUESTION_MARK),
+    ['?'] = LAYOUT_SHIFT(SLASH_AND_QUESTION_MARK),
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US_INTL)
+    // US International (Windows)
+    CYCLE_STRING_LAYOUT_ALNUM(Y, Z),
+    ['!'] = LAYOUT_SHIFT(1_AND_EXCLAMATION),
+    ['@'] = LAYOUT_SHIFT(2_AND_AT),
+    ['#'] = LAYOUT_SHIFT(3_AND_HASH),
+    ['$'] = LAYOUT_SHIFT(4_AND_DOLLAR),
+    ['%'] = LAYOUT_SHIFT(5_AND_PERCENT),
+    ['^'] = LAYOUT_DEAD_SHIFT(6_AND_CARET),
+    ['&'] = LAYOUT_SHIFT(7_AND_AMPERSAND),
+    ['*'] = LAYOUT_SHIFT(8_AND_ASTERISK),
+    ['('] = LAYOUT_SHIFT(9_AND_LEFT_PARENTHESIS),
+    [')'] = LAYOUT_SHIFT(0_AND_RIGHT_PARENTHESIS),
+    ['-'] = LAYOUT_PLAIN(MINUS_AND_UNDERSCORE),
+    ['_'] = LAYOUT_SHIFT(MINUS_AND_UNDERSCORE),
+    ['='] = LAYOUT_PLAIN(EQUAL_AND_PLUS),
+    ['+'] = LAYOUT_SHIFT(EQUAL_AND_PLUS),
+    ['['] = LAYOUT_PLAIN(LEFT_BRACKET_AND_LEFT_BRACE),
+    ['{'] = LAYOUT_SHIFT(LEFT_BRACKET_AND_LEFT_BRACE),
+    [']'] = LAYOUT_PLAIN(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['}'] = LAYOUT_SHIFT(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['\\'] = LAYOUT_PLAIN(BACKSLASH_AND_PIPE),
+    ['|'] = LAYOUT_SHIFT(BACKSLASH_AND_PIPE),
+    [';'] = LAYOUT_PLAIN(SEMICOLON_AND_COLON),
+    [':'] = LAYOUT_SHIFT(SEMICOLON_AND_COLON),
+    ['\''] = LAYOUT_DEAD(APOSTROPHE_AND_QUOTE),
+    ['"'] = LAYOUT_DEAD_SHIFT(APOSTROPHE_AND_QUOTE),
+    ['`'] = LAYOUT_DEAD(GRAVE_ACCENT_AND_TILDE),
+    ['~'] = LAYOUT_DEAD_SHIFT(GRAVE_ACCENT_AND_TILDE),
+    [','] = LAYOUT_PLAIN(COMMA_AND_LESS_THAN),
+    ['<'] = LAYOUT_SHIFT(COMMA_AND_LESS_THAN),
+    ['.'] = LAYOUT_PLAIN(PERIOD_AND_GREATER_THAN),
+    ['>'] = LAYOUT_SHIFT(PERIOD_AND_GREATER_THAN),
+    ['/'] = LAYOUT_PLAIN(SLASH_AND_QUESTION_MARK),
+    ['?'] = LAYOUT_SHIFT(SLASH_AND_QUESTION_MARK),
+    [0xA1] = LAYOUT_ALTGR(1_AND_EXCLAMATION), // ¡
+    [0xB2] = LAYOUT_ALTGR(2_AND_AT), // ²
+    [0xB3] = LAYOUT_ALTGR(3_AND_HASH), // ³
+    [0xA4] = LAYOUT_ALTGR(4_AND_DOLLAR), // ¤
+    [0xBC] = LAYOUT_ALTGR(6_AND_CARET), // ¼
+    [0xBD] = LAYOUT_ALTGR(7_AND_AMPERSAND), // ½
+    [0xBE] = LAYOUT_ALTGR(8_AND_ASTERISK), // ¾
+    [0xA5] = LAYOUT_ALTGR(MINUS_AND_UNDERSCORE), // ¥
+    [0xD7] = LAYOUT_ALTGR(EQUAL_AND_PLUS), // ×
+    [0xAB] = LAYOUT_ALTGR(LEFT_BRACKET_AND_LEFT_BRACE), // «
+    [0xBB] = LAYOUT_ALTGR(RIGHT_BRACKET_AND_RIGHT_BRACE), // »
+    [0xAC] = LAYOUT_ALTGR(BACKSLASH_AND_PIPE), // ¬
+    [0xB6] = LAYOUT_ALTGR(SEMICOLON_AND_COLON), // ¶
+    [0xB4] = LAYOUT_ALTGR(APOSTROPHE_AND_QUOTE), // ´
+    [0xBF] = LAYOUT_ALTGR(SLASH_AND_QUESTION_MARK), // ¿
+    [0xA9] = LAYOUT_ALTGR(C), // ©
+    [0xAE] = LAYOUT_ALTGR(R), // ®
+    [0xB5] = LAYOUT_ALTGR(M), // µ
+    [0xE4] = LAYOUT_ALTGR(Q), // ä
+    [0xE5] = LAYOUT_ALTGR(W), // å
+    [0xE9] = LAYOUT_ALTGR(E), // é
+    [0xFE] = LAYOUT_ALTGR(T), // þ
+    [0xFC] = LAYOUT_ALTGR(Y), // ü
+    [0xFA] = LAYOUT_ALTGR(U), // ú
+    [0xED] = LAYOUT_ALTGR(I), // í
+    [0xF3] = LAYOUT_ALTGR(O), // ó
+    [0xF6] = LAYOUT_ALTGR(P), // ö
+    [0xE1] = LAYOUT_ALTGR(A), // á
+    [0xDF] = LAYOUT_ALTGR(S), // ß
+    [0xF0] = LAYOUT_ALTGR(D), // ð
+    [0xF8] = LAYOUT_ALTGR(L), // ø
+    [0xE6] = LAYOUT_ALTGR(Z), // æ
+    [0xF1] = LAYOUT_ALTGR(N), // ñ
+    [0xE7] = LAYOUT_ALTGR(COMMA_AND_LESS_THAN), // ç
+    [0xC4] = LAYOUT_ALTGR_SHIFT(Q), // Ä
+    [0xC5] = LAYOUT_ALTGR_SHIFT(W), // Å
+    [0xC9] = LAYOUT_ALTGR_SHIFT(E), // É
+    [0xDE] = LAYOUT_ALTGR_SHIFT(T), // Þ
+    [0xDC] = LAYOUT_ALTGR_SHIFT(Y), // Ü
+    [0xDA] = LAYOUT_ALTGR_SHIFT(U), // Ú
+    [0xCD] = LAYOUT_ALTGR_SHIFT(I), // Í
+    [0xD3] = LAYOUT_ALTGR_SHIFT(O), // Ó
+    [0xD6] = LAYOUT_ALTGR_SHIFT(P), // Ö
+    [0xC1] = LAYOUT_ALTGR_SHIFT(A), // Á
+    [0xD0] = LAYOUT_ALTGR_SHIFT(D), // Ð
+    [0xD8] = LAYOUT_ALTGR_SHIFT(L), // Ø
+    [0xC6] = LAYOUT_ALTGR_SHIFT(Z), // Æ
+    [0xD1] = LAYOUT_ALTGR_SHIFT(N), // Ñ
+    [0xC7] = LAYOUT_ALTGR_SHIFT(COMMA_AND_LESS_THAN), // Ç
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_DE)
+    // German; Y and Z are swapped
+    CYCLE_STRING_LAYOUT_ALNUM(Z, Y),
+    ['!'] = LAYOUT_SHIFT(1_AND_EXCLAMATION),
+    ['"'] = LAYOUT_SHIFT(2_AND_AT),
+    [0xA7] = LAYOUT_SHIFT(3_AND_HASH), // §
+    ['$'] = LAYOUT_SHIFT(4_AND_DOLLAR),
+    ['%'] = LAYOUT_SHIFT(5_AND_PERCENT),
+    ['&'] = LAYOUT_SHIFT(6_AND_CARET),
+    ['/'] = LAYOUT_SHIFT(7_AND_AMPERSAND),
+    ['('] = LAYOUT_SHIFT(8_AND_ASTERISK),
+    [')'] = LAYOUT_SHIFT(9_AND_LEFT_PARENTHESIS),
+    ['='] = LAYOUT_SHIFT(0_AND_RIGHT_PARENTHESIS),
+    [0xB2] = LAYOUT_ALTGR(2_AND_AT), // ²
+    [0xB3] = LAYOUT_ALTGR(3_AND_HASH), // ³
+    ['{'] = LAYOUT_ALTGR(7_AND_AMPERSAND),
+    ['['] = LAYOUT_ALTGR(8_AND_ASTERISK),
+    [']'] = LAYOUT_ALTGR(9_AND_LEFT_PARENTHESIS),
+    ['}'] = LAYOUT_ALTGR(0_AND_RIGHT_PARENTHESIS),
+    [0xDF] = LAYOUT_PLAIN(MINUS_AND_UNDERSCORE), // ß
+    ['?'] = LAYOUT_SHIFT(MINUS_AND_UNDERSCORE),
+    ['\\'] = LAYOUT_ALTGR(MINUS_AND_UNDERSCORE),
+    [0xB4] = LAYOUT_DEAD(EQUAL_AND_PLUS), // ´
+    ['`'] = LAYOUT_DEAD_SHIFT(EQUAL_AND_PLUS),
+    [0xFC] = LAYOUT_PLAIN(LEFT_BRACKET_AND_LEFT_BRACE), // ü
+    [0xDC] = LAYOUT_SHIFT(LEFT_BRACKET_AND_LEFT_BRACE), // Ü
+    ['+'] = LAYOUT_PLAIN(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['*'] = LAYOUT_SHIFT(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['~'] = LAYOUT_ALTGR(RIGHT_BRACKET_AND_RIGHT_BRACE),
+    ['#'] = LAYOUT_PLAIN(NON_US_HASH_AND_TILDE),
+    ['\''] = LAYOUT_SHIFT(NON_US_HASH_AND_TILDE),
+    [0xF6] = LAYOUT_PLAIN(SEMICOLON_AND_COLON), // ö
+    [0xD6] = LAYOUT_SHIFT(SEMICOLON_AND_COLON), // Ö
+    [0xE4] = LAYOUT_PLAIN(APOSTROPHE_AND_QUOTE), // ä
+    [0xC4] = LAYOUT_SHIFT(APOSTROPHE_AND_QUOTE), // Ä
+    ['^'] = LAYOUT_DEAD(GRAVE_ACCENT_AND_TILDE),
+    [0xB0] = LAYOUT_SHIFT(GRAVE_ACCENT_AND_TILDE), // °
+    ['<'] = LAYOUT_PLAIN(NON_US_BACKSLASH_AND_PIPE),
+    ['>'] = LAYOUT_SHIFT(NON_US_BACKSLASH_AND_PIPE),
+    ['|'] = LAYOUT_ALTGR(NON_US_BACKSLASH_AND_PIPE),
+    [','] = LAYOUT_PLAIN(COMMA_AND_LESS_THAN),
+    [';'] = LAYOUT_SHIFT(COMMA_AND_LESS_THAN),
+    ['.'] = LAYOUT_PLAIN(PERIOD_AND_GREATER_THAN),
+    [':'] = LAYOUT_SHIFT(PERIOD_AND_GREATER_THAN),
+    ['-'] = LAYOUT_PLAIN(SLASH_AND_QUESTION_MARK),
+    ['_'] = LAYOUT_SHIFT(SLASH_AND_QUESTION_MARK),
+    ['@'] = LAYOUT_ALTGR(Q),
+    [0xB5] = LAYOUT_ALTGR(M), // µ
+#endif
+};
+
+#undef CYCLE_STRING_LAYOUT_ALNUM
+#undef LAYOUT_DEAD_ALTGR
+#undef LAYOUT_DEAD_SHIFT
+#undef LAYOUT_DEAD
+#undef LAYOUT_ALTGR_SHIFT
+#undef LAYOUT_ALTGR
+#undef LAYOUT_SHIFT
+#undef LAYOUT_PLAIN
+#undef LAYOUT_KEY
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_LAYOUT_H
@@ -0,0 +1,16 @@
+/*
+ * Generated from cycle_string_lists.h by chords/generate_cycle_string_table.py
+ * DO NOT EDIT MANUALLY
+ *
+ * Sizes of the tables in cycle_string_table.h, without their data.
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H
+
+#define CYCLE_STRING_LISTS 822
+#define CYCLE_STRING_MAX_VARIANTS 6
+#define CYCLE_STRING_USAGE_SLOTS 1477
+#define CYCLE_STRING_TABLE_CRC 0x54AD74C6u
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_LIMITS_H
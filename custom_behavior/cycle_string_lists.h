@@ -3,6 +3,10 @@
 
 #include <stddef.h> // For size_t
 
+// Source word lists for the cycle string behavior. The firmware does not
+// include this file directly: run chords/generate_cycle_string_table.py after
+// editing it to regenerate the pre-encoded cycle_string_table.h.
+
 // Structure to hold a cycle list and its length
 typedef struct {
   const char **strings;
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_PUNCTUATION_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_PUNCTUATION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <dt-bindings/zmk/hid_usage.h>
+#include <zephyr/sys/util.h>
+
+// What to do when a key is pressed right after a cycle string: erase the
+// trailing space, type the key as pressed instead, then re-add the space if
+// the rule asks for it. Keys without a rule pass through.
+#define CYCLE_STRING_RULE_REPLACE BIT(0)
+#define CYCLE_STRING_RULE_SPACE BIT(1)
+// What the key does to the sentence, for
+// CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_SENTENCE_CASE: ends it, or leaves it as it
+// is. Any other key continues it, Backspace too: a '.' it deletes no longer
+// ends the sentence.
+#define CYCLE_STRING_RULE_ENDS_SENTENCE BIT(2)
+#define CYCLE_STRING_RULE_KEEPS_SENTENCE BIT(3)
+
+#define RULE_SPACE CYCLE_STRING_RULE_SPACE
+#define RULE_ENDS CYCLE_STRING_RULE_ENDS_SENTENCE
+#define RULE_KEEPS CYCLE_STRING_RULE_KEEPS_SENTENCE
+
+// A key that replaces the space after a cycle string
+#define CYCLE_STRING_RULE(usage, shifted, flags)                               \
+  [HID_USAGE_KEY_KEYBOARD_##usage][shifted] = CYCLE_STRING_RULE_REPLACE | (flags)
+// A key that only matters for sentence tracking
+#define CYCLE_STRING_KEY(usage, flags)                                         \
+  [HID_USAGE_KEY_KEYBOARD_##usage] = {(flags), (flags)}
+
+// Post-cycle punctuation rules for the host layout picked in Kconfig, indexed
+// by the HID usage of the key pressed and whether it carries Shift. Add a
+// line here to add a rule; the listener only ever does a single indexed load.
+static const uint8_t cycle_string_punctuation_rules[256][2] = {
+    CYCLE_STRING_KEY(RETURN_ENTER, RULE_ENDS),
+    CYCLE_STRING_KEY(SPACEBAR, RULE_KEEPS),
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_SE)
+    CYCLE_STRING_RULE(PERIOD_AND_GREATER_THAN, false, RULE_SPACE | RULE_ENDS), // .
+    CYCLE_STRING_RULE(PERIOD_AND_GREATER_THAN, true, RULE_SPACE),              // :
+    CYCLE_STRING_RULE(COMMA_AND_LESS_THAN, false, RULE_SPACE),                 // ,
+    CYCLE_STRING_RULE(COMMA_AND_LESS_THAN, true, RULE_SPACE),                  // ;
+    CYCLE_STRING_RULE(1_AND_EXCLAMATION, true, RULE_SPACE | RULE_ENDS),        // !
+    CYCLE_STRING_RULE(MINUS_AND_UNDERSCORE, true, RULE_SPACE | RULE_ENDS),     // ?
+    CYCLE_STRING_RULE(MINUS_AND_UNDERSCORE, false, RULE_SPACE),                // +
+    CYCLE_STRING_RULE(BACKSLASH_AND_PIPE, false, 0),                           // ' joins the word
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US) ||                \
+    IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_US_INTL)
+    CYCLE_STRING_RULE(PERIOD_AND_GREATER_THAN, false, RULE_SPACE | RULE_ENDS), // .
+    CYCLE_STRING_RULE(SEMICOLON_AND_COLON, true, RULE_SPACE),                  // :
+    CYCLE_STRING_RULE(COMMA_AND_LESS_THAN, false, RULE_SPACE),                 // ,
+    CYCLE_STRING_RULE(SEMICOLON_AND_COLON, false, RULE_SPACE),                 // ;
+    CYCLE_STRING_RULE(1_AND_EXCLAMATION, true, RULE_SPACE | RULE_ENDS),        // !
+    CYCLE_STRING_RULE(SLASH_AND_QUESTION_MARK, true, RULE_SPACE | RULE_ENDS),  // ?
+    CYCLE_STRING_RULE(EQUAL_AND_PLUS, true, RULE_SPACE),                       // +
+    CYCLE_STRING_RULE(APOSTROPHE_AND_QUOTE, false, 0),                         // ' joins the word
+#elif IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_LAYOUT_DE)
+    CYCLE_STRING_RULE(PERIOD_AND_GREATER_THAN, false, RULE_SPACE | RULE_ENDS), // .
+    CYCLE_STRING_RULE(PERIOD_AND_GREATER_THAN, true, RULE_SPACE),              // :
+    CYCLE_STRING_RULE(COMMA_AND_LESS_THAN, false, RULE_SPACE),                 // ,
+    CYCLE_STRING_RULE(COMMA_AND_LESS_THAN, true, RULE_SPACE),                  // ;
+    CYCLE_STRING_RULE(1_AND_EXCLAMATION, true, RULE_SPACE | RULE_ENDS),        // !
+    CYCLE_STRING_RULE(MINUS_AND_UNDERSCORE, true, RULE_SPACE | RULE_ENDS),     // ?
+    CYCLE_STRING_RULE(RIGHT_BRACKET_AND_RIGHT_BRACE, false, RULE_SPACE),       // +
+    CYCLE_STRING_RULE(NON_US_HASH_AND_TILDE, true, 0),                         // ' joins the word
+#endif
+};
+
+#undef CYCLE_STRING_RULE
+#undef CYCLE_STRING_KEY
+#undef RULE_SPACE
+#undef RULE_ENDS
+#undef RULE_KEEPS
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_PUNCTUATION_H
@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/shell/shell.h>
+
+// Root of the "cycle_str" shell commands. The debug modules add their own
+// subcommands with SHELL_SUBCMD_ADD((cycle_str), ...), so only the enabled
+// ones are linked in.
+SHELL_SUBCMD_SET_CREATE(cycle_str_cmds, (cycle_str));
+SHELL_CMD_REGISTER(cycle_str, &cycle_str_cmds, "Cycle string behavior", NULL);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include "cycle_string_stats.h"
+#include "cycle_string_tables.h"
+
+struct list_stats {
+  uint16_t sequences;  // Cycle sequences started
+  uint16_t steps;      // Repeat presses, so steps / sequences is the mean depth
+  uint16_t punctuated; // Sequences ended by a punctuation rule
+};
+
+// Counters saturate rather than wrap, so a long uptime never makes a busy
+// list look unused. Sized for the built-in table; lists an uploaded
+// dictionary has past that are not counted.
+static struct list_stats list_stats[CYCLE_STRING_LISTS];
+
+static inline void saturating_inc(uint16_t *counter) {
+  if (*counter != UINT16_MAX) {
+    ++*counter;
+  }
+}
+
+void cycle_string_stats_sequence(uint32_t list_index) {
+  if (list_index < ARRAY_SIZE(list_stats)) {
+    saturating_inc(&list_stats[list_index].sequences);
+  }
+}
+
+void cycle_string_stats_step(uint32_t list_index) {
+  if (list_index < ARRAY_SIZE(list_stats)) {
+    saturating_inc(&list_stats[list_index].steps);
+  }
+}
+
+void cycle_string_stats_punctuated(uint32_t list_index) {
+  if (list_index < ARRAY_SIZE(list_stats)) {
+    saturating_inc(&list_stats[list_index].punctuated);
+  }
+}
+
+void cycle_string_stats_reset(void) { memset(list_stats, 0, sizeof(list_stats)); }
+
+// One CSV line per list that was used, for chords/ tooling to read back:
+// list index as in cycle_string_lists.h, then the counters
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+    cycle_string_stats_reset();
+    shell_print(sh, "Cycle string stats cleared");
+    return 0;
+  }
+  bool all = argc > 1 && strcmp(argv[1], "all") == 0;
+  shell_print(sh, "list,sequences,steps,punctuated");
+  for (size_t i = 0; i < ARRAY_SIZE(list_stats); ++i) {
+    const struct list_stats *stats = &list_stats[i];
+    if (!all && stats->sequences == 0) {
+      continue;
+    }
+    shell_print(sh, "%u,%u,%u,%u", (unsigned)i, stats->sequences, stats->steps,
+                stats->punctuated);
+  }
+  return 0;
+}
+
+SHELL_SUBCMD_ADD((cycle_str), stats, NULL,
+                 "Print per-list counters as CSV (\"all\" includes unused lists, "
+                 "\"reset\" clears them)",
+                 cmd_stats, 1, 1);
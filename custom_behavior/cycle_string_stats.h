@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_STATS_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_STATS_H
+
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+// Per-list usage counters, dumped with the "cycle_str stats" shell command.
+// Every hook is a single RAM increment, and with
+// CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_STATS off they compile to nothing.
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_STATS)
+
+// A cycle sequence started on a list
+void cycle_string_stats_sequence(uint32_t list_index);
+
+// A repeat press cycled one variant deeper into a list
+void cycle_string_stats_step(uint32_t list_index);
+
+// A punctuation rule replaced the space after a list's variant
+void cycle_string_stats_punctuated(uint32_t list_index);
+
+// Clear every counter
+void cycle_string_stats_reset(void);
+
+#else
+
+static inline void cycle_string_stats_sequence(uint32_t list_index) {}
+static inline void cycle_string_stats_step(uint32_t list_index) {}
+static inline void cycle_string_stats_punctuated(uint32_t list_index) {}
+static inline void cycle_string_stats_reset(void) {}
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_STATS)
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_STATS_H
@@ -0,0 +1,3584 @@
+/*
+ * Generated from cycle_string_lists.h by chords/generate_cycle_string_table.py
+ * DO NOT EDIT MANUALLY
+ *
+ * Front-coded cycle lists in one blob, see cycle_string_dict.h for the format.
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include "cycle_string_dict.h"
+#include "cycle_string_limits.h"
+
+static const uint8_t cycle_string_blob[] = {
+    // 0
+    0, 3, 't', 'h', 'e', // the
+    // 1
+    0, 2, 'b', 'e', // be
+    2, 2, 'e', 'n', // been
+    2, 3, 'i', 'n', 'g', // being
+    // 2
+    0, 2, 'i', 's', // is
+    // 3
+    0, 3, 'a', 'r', 'e', // are
+    // 4
+    0, 3, 'w', 'a', 's', // was
+    1, 3, 'e', 'r', 'e', // were
+    // 5
+    0, 3, 'a', 'n', 'd', // and
+    // 6
+    0, 1, 'a', // a
+    // 7
+    0, 2, 'a', 'n', // an
+    // 8
+    0, 2, 'o', 'f', // of
+    // 9
+    0, 2, 't', 'o', // to
+    // 10
+    0, 2, 'i', 'n', // in
+    // 11
+    0, 1, 'i', // i
+    // 12
+    0, 4, 'm', 'i', 'n', 'e', // mine
+    // 13
+    0, 2, 'm', 'y', // my
+    // 14
+    0, 4, 'i', 0x27, 'v', 'e', // i've
+    // 15
+    0, 3, 'i', 0x27, 'm', // i'm
+    // 16
+    0, 4, 'i', 0x27, 'l', 'l', // i'll
+    // 17
+    0, 3, 'y', 'o', 'u', // you
+    3, 1, 'r', // your
+    3, 3, 0x27, 'r', 'e', // you're
+    3, 2, 'r', 's', // yours
+    // 18
+    0, 2, 'i', 't', // it
+    2, 1, 's', // its
+    // 19
+    0, 4, 'h', 'a', 'v', 'e', // have
+    4, 3, 'n', 0x27, 't', // haven't
+    // 20
+    0, 3, 'h', 'a', 's', // has
+    3, 3, 'n', 0x27, 't', // hasn't
+    // 21
+    0, 3, 'h', 'a', 'd', // had
+    3, 3, 'n', 0x27, 't', // hadn't
+    // 22
+    0, 6, 'h', 'a', 'v', 'i', 'n', 'g', // having
+    // 23
+    0, 4, 't', 'h', 'a', 't', // that
+    4, 2, 0x27, 's', // that's
+    // 24
+    0, 3, 'f', 'o', 'r', // for
+    // 25
+    0, 2, 'd', 'o', // do
+    2, 2, 'e', 's', // does
+    2, 3, 'i', 'n', 'g', // doing
+    1, 2, 'i', 'd', // did
+    // 26
+    0, 4, 'd', 'o', 'e', 's', // does
+    // 27
+    0, 5, 'd', 'o', 'i', 'n', 'g', // doing
+    // 28
+    0, 3, 'd', 'i', 'd', // did
+    // 29
+    0, 5, 'd', 'o', 'n', 0x27, 't', // don't
+    // 30
+    0, 5, 'w', 'o', 'n', 0x27, 't', // won't
+    // 31
+    0, 2, 'h', 'e', // he
+    2, 2, 0x27, 's', // he's
+    3, 2, 'l', 'l', // he'll
+    // 32
+    0, 4, 'w', 'i', 't', 'h', // with
+    // 33
+    0, 2, 'o', 'n', // on
+    // 34
+    0, 2, 'o', 'k', // ok
+    // 35
+    0, 4, 't', 'h', 'i', 's', // this
+    // 36
+    0, 2, 'w', 'e', // we
+    0, 3, 'o', 'u', 'r', // our
+    0, 2, 'u', 's', // us
+    0, 4, 'o', 'u', 'r', 's', // ours
+    // 37
+    0, 3, 'n', 'o', 't', // not
+    // 38
+    0, 3, 'b', 'u', 't', // but
+    // 39
+    0, 4, 't', 'h', 'e', 'y', // they
+    3, 2, 'i', 'r', // their
+    3, 1, 'm', // them
+    3, 3, 'i', 'r', 's', // theirs
+    // 40
+    0, 7, 't', 'h', 'e', 'y', 0x27, 'v', 'e', // they've
+    // 41
+    0, 6, 'y', 'o', 'u', 0x27, 'v', 'e', // you've
+    // 42
+    0, 3, 's', 'a', 'y', // say
+    3, 1, 's', // says
+    3, 3, 'i', 'n', 'g', // saying
+    2, 2, 'i', 'd', // said
+    // 43
+    0, 2, 'a', 't', // at
+    // 44
+    0, 4, 'w', 'h', 'a', 't', // what
+    // 45
+    0, 4, 'f', 'r', 'o', 'm', // from
+    // 46
+    0, 2, 'g', 'o', // go
+    2, 3, 'i', 'n', 'g', // going
+    2, 2, 'e', 's', // goes
+    0, 4, 'w', 'e', 'n', 't', // went
+    // 47
+    0, 5, 'g', 'o', 'i', 'n', 'g', // going
+    // 48
+    0, 2, 'o', 'r', // or
+    // 49
+    0, 2, 'b', 'y', // by
+    // 50
+    0, 3, 'g', 'e', 't', // get
+    3, 1, 's', // gets
+    3, 4, 't', 'i', 'n', 'g', // getting
+    1, 2, 'o', 't', // got
+    // 51
+    0, 3, 's', 'h', 'e', // she
+    3, 2, 0x27, 's', // she's
+    4, 2, 'l', 'l', // she'll
+    // 52
+    0, 3, 'h', 'e', 'r', // her
+    3, 1, 's', // hers
+    // 53
+    0, 3, 'c', 'a', 'n', // can
+    1, 4, 'o', 'u', 'l', 'd', // could
+    // 54
+    0, 5, 'c', 'o', 'u', 'l', 'd', // could
+    // 55
+    0, 2, 'a', 's', // as
+    // 56
+    0, 4, 'k', 'n', 'o', 'w', // know
+    4, 1, 's', // knows
+    4, 3, 'i', 'n', 'g', // knowing
+    2, 2, 'e', 'w', // knew
+    2, 3, 'o', 'w', 'n', // known
+    // 57
+    0, 2, 'i', 'f', // if
+    // 58
+    0, 2, 'm', 'e', // me
+    1, 1, 'y', // my
+    2, 4, 's', 'e', 'l', 'f', // myself
+    // 59
+    0, 4, 'y', 'o', 'u', 'r', // your
+    4, 1, 's', // yours
+    // 60
+    0, 3, 'a', 'l', 'l', // all
+    // 61
+    0, 3, 'w', 'h', 'o', // who
+    // 62
+    0, 5, 'a', 'b', 'o', 'u', 't', // about
+    // 63
+    0, 4, 'w', 'i', 'l', 'l', // will
+    // 64
+    0, 2, 's', 'o', // so
+    // 65
+    0, 5, 'w', 'o', 'u', 'l', 'd', // would
+    // 66
+    0, 4, 'm', 'a', 'k', 'e', // make
+    4, 1, 's', // makes
+    3, 3, 'i', 'n', 'g', // making
+    2, 2, 'd', 'e', // made
+    // 67
+    0, 4, 'j', 'u', 's', 't', // just
+    // 68
+    0, 2, 'u', 'p', // up
+    // 69
+    0, 5, 't', 'h', 'i', 'n', 'k', // think
+    5, 1, 's', // thinks
+    5, 3, 'i', 'n', 'g', // thinking
+    2, 5, 'o', 'u', 'g', 'h', 't', // thought
+    // 70
+    0, 4, 't', 'i', 'm', 'e', // time
+    4, 1, 's', // times
+    // 71
+    0, 5, 't', 'h', 'e', 'r', 'e', // there
+    // 72
+    0, 3, 's', 'e', 'e', // see
+    3, 1, 's', // sees
+    3, 3, 'i', 'n', 'g', // seeing
+    1, 2, 'a', 'w', // saw
+    // 73
+    0, 3, 'o', 'u', 't', // out
+    // 74
+    0, 3, 'o', 'n', 'e', // one
+    // 75
+    0, 4, 'c', 'o', 'm', 'e', // come
+    4, 1, 's', // comes
+    3, 3, 'i', 'n', 'g', // coming
+    1, 3, 'a', 'm', 'e', // came
+    // 76
+    0, 6, 'p', 'e', 'o', 'p', 'l', 'e', // people
+    // 77
+    0, 4, 't', 'a', 'k', 'e', // take
+    4, 1, 's', // takes
+    3, 3, 'i', 'n', 'g', // taking
+    1, 3, 'o', 'o', 'k', // took
+    // 78
+    0, 4, 'y', 'e', 'a', 'r', // year
+    4, 1, 's', // years
+    // 79
+    0, 3, 'h', 'i', 'm', // him
+    2, 1, 's', // his
+    // 80
+    0, 3, 'h', 'i', 's', // his
+    // 81
+    0, 4, 't', 'h', 'e', 'm', // them
+    3, 2, 'i', 'r', // their
+    // 82
+    0, 4, 's', 'o', 'm', 'e', // some
+    // 83
+    0, 4, 'w', 'a', 'n', 't', // want
+    4, 1, 's', // wants
+    4, 3, 'i', 'n', 'g', // wanting
+    4, 2, 'e', 'd', // wanted
+    // 84
+    0, 3, 'h', 'o', 'w', // how
+    // 85
+    0, 4, 'w', 'h', 'e', 'n', // when
+    // 86
+    0, 5, 'w', 'h', 'i', 'c', 'h', // which
+    // 87
+    0, 3, 'n', 'o', 'w', // now
+    // 88
+    0, 4, 'l', 'i', 'k', 'e', // like
+    4, 1, 's', // likes
+    3, 3, 'i', 'n', 'g', // liking
+    3, 2, 'e', 'd', // liked
+    // 89
+    0, 5, 'o', 't', 'h', 'e', 'r', // other
+    5, 1, 's', // others
+    // 90
+    0, 3, 'o', 'u', 'r', // our
+    3, 1, 's', // ours
+    // 91
+    0, 4, 'i', 'n', 't', 'o', // into
+    // 92
+    0, 4, 'h', 'e', 'r', 'e', // here
+    // 93
+    0, 4, 't', 'h', 'e', 'n', // then
+    // 94
+    0, 4, 't', 'h', 'a', 'n', // than
+    // 95
+    0, 4, 'l', 'o', 'o', 'k', // look
+    4, 1, 's', // looks
+    4, 3, 'i', 'n', 'g', // looking
+    4, 2, 'e', 'd', // looked
+    // 96
+    0, 3, 'w', 'a', 'y', // way
+    3, 1, 's', // ways
+    // 97
+    0, 4, 'm', 'o', 'r', 'e', // more
+    // 98
+    0, 5, 't', 'h', 'e', 's', 'e', // these
+    // 99
+    0, 2, 'n', 'o', // no
+    // 100
+    0, 5, 't', 'h', 'i', 'n', 'g', // thing
+    5, 1, 's', // things
+    // 101
+    0, 4, 'w', 'e', 'l', 'l', // well
+    0, 6, 'b', 'e', 't', 't', 'e', 'r', // better
+    2, 2, 's', 't', // best
+    // 102
+    0, 7, 'b', 'e', 'c', 'a', 'u', 's', 'e', // because
+    // 103
+    0, 4, 'a', 'l', 's', 'o', // also
+    // 104
+    0, 3, 't', 'w', 'o', // two
+    // 105
+    0, 3, 'u', 's', 'e', // use
+    3, 1, 's', // uses
+    2, 3, 'i', 'n', 'g', // using
+    2, 2, 'e', 'd', // used
+    // 106
+    0, 4, 't', 'e', 'l', 'l', // tell
+    4, 1, 's', // tells
+    4, 3, 'i', 'n', 'g', // telling
+    1, 3, 'o', 'l', 'd', // told
+    // 107
+    0, 4, 'g', 'o', 'o', 'd', // good
+    0, 6, 'b', 'e', 't', 't', 'e', 'r', // better
+    2, 2, 's', 't', // best
+    // 108
+    0, 5, 'f', 'i', 'r', 's', 't', // first
+    // 109
+    0, 3, 'm', 'a', 'n', // man
+    1, 2, 'e', 'n', // men
+    // 110
+    0, 3, 'd', 'a', 'y', // day
+    3, 1, 's', // days
+    // 111
+    0, 4, 'f', 'i', 'n', 'd', // find
+    4, 1, 's', // finds
+    4, 3, 'i', 'n', 'g', // finding
+    1, 4, 'o', 'u', 'n', 'd', // found
+    // 112
+    0, 4, 'g', 'i', 'v', 'e', // give
+    4, 1, 's', // gives
+    3, 3, 'i', 'n', 'g', // giving
+    1, 3, 'a', 'v', 'e', // gave
+    // 113
+    0, 3, 'n', 'e', 'w', // new
+    3, 2, 'e', 'r', // newer
+    4, 2, 's', 't', // newest
+    // 114
+    0, 2, 'u', 's', // us
+    // 115
+    0, 3, 'a', 'n', 'y', // any
+    // 116
+    0, 5, 't', 'h', 'o', 's', 'e', // those
+    // 117
+    0, 4, 'v', 'e', 'r', 'y', // very
+    // 118
+    0, 4, 'n', 'e', 'e', 'd', // need
+    4, 1, 's', // needs
+    4, 3, 'i', 'n', 'g', // needing
+    4, 2, 'e', 'd', // needed
+    // 119
+    0, 4, 'b', 'a', 'c', 'k', // back
+    4, 1, 's', // backs
+    4, 3, 'i', 'n', 'g', // backing
+    4, 2, 'e', 'd', // backed
+    // 120
+    0, 6, 's', 'h', 'o', 'u', 'l', 'd', // should
+    // 121
+    0, 4, 'e', 'v', 'e', 'n', // even
+    // 122
+    0, 4, 'o', 'n', 'l', 'y', // only
+    // 123
+    0, 4, 'm', 'a', 'n', 'y', // many
+    // 124
+    0, 6, 'r', 'e', 'a', 'l', 'l', 'y', // really
+    // 125
+    0, 4, 'w', 'o', 'r', 'k', // work
+    4, 1, 's', // works
+    4, 3, 'i', 'n', 'g', // working
+    4, 2, 'e', 'd', // worked
+    // 126
+    0, 4, 'l', 'i', 'f', 'e', // life
+    2, 3, 'v', 'e', 's', // lives
+    // 127
+    0, 3, 'w', 'h', 'y', // why
+    // 128
+    0, 5, 'r', 'i', 'g', 'h', 't', // right
+    5, 1, 's', // rights
+    // 129
+    0, 4, 'd', 'o', 'w', 'n', // down
+    // 130
+    0, 3, 't', 'r', 'y', // try
+    2, 3, 'i', 'e', 's', // tries
+    2, 4, 'y', 'i', 'n', 'g', // trying
+    2, 3, 'i', 'e', 'd', // tried
+    // 131
+    0, 3, 'l', 'e', 't', // let
+    3, 1, 's', // lets
+    3, 4, 't', 'i', 'n', 'g', // letting
+    3, 0, // let
+    // 132
+    0, 9, 's', 'o', 'm', 'e', 't', 'h', 'i', 'n', 'g', // something
+    // 133
+    0, 3, 't', 'o', 'o', // too
+    // 134
+    0, 4, 'c', 'a', 'l', 'l', // call
+    4, 1, 's', // calls
+    4, 3, 'i', 'n', 'g', // calling
+    4, 2, 'e', 'd', // called
+    // 135
+    0, 5, 'w', 'o', 'm', 'a', 'n', // woman
+    3, 2, 'e', 'n', // women
+    // 136
+    0, 3, 'm', 'a', 'y', // may
+    // 137
+    0, 5, 's', 't', 'i', 'l', 'l', // still
+    // 138
+    0, 7, 't', 'h', 'r', 'o', 'u', 'g', 'h', // through
+    // 139
+    0, 4, 'm', 'e', 'a', 'n', // mean
+    4, 1, 's', // means
+    4, 3, 'i', 'n', 'g', // meaning
+    4, 1, 't', // meant
+    // 140
+    0, 5, 'a', 'f', 't', 'e', 'r', // after
+    // 141
+    0, 5, 'n', 'e', 'v', 'e', 'r', // never
+    // 142
+    0, 5, 'w', 'o', 'r', 'l', 'd', // world
+    5, 1, 's', // worlds
+    // 143
+    0, 4, 'f', 'e', 'e', 'l', // feel
+    4, 1, 's', // feels
+    4, 3, 'i', 'n', 'g', // feeling
+    2, 2, 'l', 't', // felt
+    // 144
+    0, 3, 'f', 'i', 'x', // fix
+    3, 2, 'e', 's', // fixes
+    4, 1, 'd', // fixed
+    // 145
+    0, 5, 'g', 'r', 'e', 'a', 't', // great
+    5, 2, 'e', 'r', // greater
+    6, 2, 's', 't', // greatest
+    // 146
+    0, 4, 'l', 'a', 's', 't', // last
+    // 147
+    0, 5, 'c', 'h', 'i', 'l', 'd', // child
+    5, 3, 'r', 'e', 'n', // children
+    // 148
+    0, 2, 'o', 'h', // oh
+    // 149
+    0, 2, 'a', 'h', // ah
+    // 150
+    0, 4, 'o', 'v', 'e', 'r', // over
+    // 151
+    0, 3, 'a', 's', 'k', // ask
+    3, 1, 's', // asks
+    3, 3, 'i', 'n', 'g', // asking
+    3, 2, 'e', 'd', // asked
+    // 152
+    0, 5, 's', 't', 'a', 't', 'e', // state
+    5, 1, 's', // states
+    5, 1, 'd', // stated
+    4, 3, 'i', 'n', 'g', // stating
+    // 153
+    0, 4, 'm', 'u', 'c', 'h', // much
+    // 154
+    0, 4, 't', 'a', 'l', 'k', // talk
+    4, 1, 's', // talks
+    4, 3, 'i', 'n', 'g', // talking
+    4, 2, 'e', 'd', // talked
+    // 155
+    0, 4, 'k', 'e', 'e', 'p', // keep
+    4, 1, 's', // keeps
+    4, 3, 'i', 'n', 'g', // keeping
+    2, 2, 'p', 't', // kept
+    // 156
+    0, 5, 'l', 'e', 'a', 'v', 'e', // leave
+    5, 1, 's', // leaves
+    4, 3, 'i', 'n', 'g', // leaving
+    2, 2, 'f', 't', // left
+    // 157
+    0, 3, 'p', 'u', 't', // put
+    3, 1, 's', // puts
+    3, 4, 't', 'i', 'n', 'g', // putting
+    3, 0, // put
+    // 158
+    0, 4, 'h', 'e', 'l', 'p', // help
+    4, 1, 's', // helps
+    4, 3, 'i', 'n', 'g', // helping
+    4, 2, 'e', 'd', // helped
+    // 159
+    0, 3, 'b', 'i', 'g', // big
+    3, 3, 'g', 'e', 'r', // bigger
+    5, 2, 's', 't', // biggest
+    // 160
+    0, 5, 'w', 'h', 'e', 'r', 'e', // where
+    // 161
+    0, 4, 's', 'a', 'm', 'e', // same
+    // 162
+    0, 3, 'o', 'w', 'n', // own
+    3, 1, 's', // owns
+    3, 3, 'i', 'n', 'g', // owning
+    3, 2, 'e', 'd', // owned
+    // 163
+    0, 5, 'w', 'h', 'i', 'l', 'e', // while
+    // 164
+    0, 5, 's', 't', 'a', 'r', 't', // start
+    5, 1, 's', // starts
+    5, 3, 'i', 'n', 'g', // starting
+    5, 2, 'e', 'd', // started
+    // 165
+    0, 5, 't', 'h', 'r', 'e', 'e', // three
+    // 166
+    0, 4, 'h', 'i', 'g', 'h', // high
+    4, 2, 'e', 'r', // higher
+    5, 2, 's', 't', // highest
+    // 167
+    0, 5, 'e', 'v', 'e', 'r', 'y', // every
+    // 168
+    0, 7, 'a', 'n', 'o', 't', 'h', 'e', 'r', // another
+    // 169
+    0, 6, 'b', 'e', 'c', 'o', 'm', 'e', // become
+    6, 1, 's', // becomes
+    5, 3, 'i', 'n', 'g', // becoming
+    3, 3, 'a', 'm', 'e', // became
+    // 170
+    0, 4, 'm', 'o', 's', 't', // most
+    // 171
+    0, 7, 'b', 'e', 't', 'w', 'e', 'e', 'n', // between
+    // 172
+    0, 6, 'h', 'a', 'p', 'p', 'e', 'n', // happen
+    6, 1, 's', // happens
+    6, 3, 'i', 'n', 'g', // happening
+    6, 2, 'e', 'd', // happened
+    // 173
+    0, 6, 'f', 'a', 'm', 'i', 'l', 'y', // family
+    5, 3, 'i', 'e', 's', // families
+    // 174
+    0, 3, 'o', 'l', 'd', // old
+    3, 2, 'e', 'r', // older
+    4, 2, 's', 't', // oldest
+    // 175
+    0, 3, 'y', 'e', 's', // yes
+    // 176
+    0, 5, 'h', 'o', 'u', 's', 'e', // house
+    5, 1, 's', // houses
+    // 177
+    0, 4, 's', 'h', 'o', 'w', // show
+    4, 1, 's', // shows
+    4, 3, 'i', 'n', 'g', // showing
+    4, 2, 'e', 'd', // showed
+    // 178
+    0, 5, 'a', 'g', 'a', 'i', 'n', // again
+    // 179
+    0, 7, 's', 't', 'u', 'd', 'e', 'n', 't', // student
+    7, 1, 's', // students
+    // 180
+    0, 4, 's', 'e', 'e', 'm', // seem
+    4, 1, 's', // seems
+    4, 3, 'i', 'n', 'g', // seeming
+    4, 2, 'e', 'd', // seemed
+    // 181
+    0, 5, 'm', 'i', 'g', 'h', 't', // might
+    // 182
+    0, 4, 'p', 'a', 'r', 't', // part
+    4, 1, 's', // parts
+    // 183
+    0, 4, 'h', 'e', 'a', 'r', // hear
+    4, 1, 's', // hears
+    4, 3, 'i', 'n', 'g', // hearing
+    4, 1, 'd', // heard
+    // 184
+    0, 3, 'i', 't', 's', // its
+    2, 2, 0x27, 's', // it's
+    // 185
+    0, 5, 'p', 'l', 'a', 'c', 'e', // place
+    5, 1, 's', // places
+    4, 3, 'i', 'n', 'g', // placing
+    4, 2, 'e', 'd', // placed
+    // 186
+    0, 7, 'p', 'r', 'o', 'b', 'l', 'e', 'm', // problem
+    7, 1, 's', // problems
+    // 187
+    0, 7, 'b', 'e', 'l', 'i', 'e', 'v', 'e', // believe
+    7, 1, 's', // believes
+    6, 3, 'i', 'n', 'g', // believing
+    6, 2, 'e', 'd', // believed
+    // 188
+    0, 7, 'c', 'o', 'u', 'n', 't', 'r', 'y', // country
+    6, 3, 'i', 'e', 's', // countries
+    // 189
+    0, 6, 'a', 'l', 'w', 'a', 'y', 's', // always
+    // 190
+    0, 4, 'w', 'e', 'e', 'k', // week
+    4, 1, 's', // weeks
+    // 191
+    0, 5, 'p', 'o', 'i', 'n', 't', // point
+    5, 1, 's', // points
+    5, 3, 'i', 'n', 'g', // pointing
+    5, 2, 'e', 'd', // pointed
+    // 192
+    0, 4, 'h', 'a', 'n', 'd', // hand
+    4, 1, 's', // hands
+    4, 3, 'i', 'n', 'g', // handing
+    4, 2, 'e', 'd', // handed
+    // 193
+    0, 3, 'o', 'f', 'f', // off
+    // 194
+    0, 4, 'p', 'l', 'a', 'y', // play
+    4, 1, 's', // plays
+    4, 3, 'i', 'n', 'g', // playing
+    4, 2, 'e', 'd', // played
+    // 195
+    0, 4, 't', 'u', 'r', 'n', // turn
+    4, 1, 's', // turns
+    4, 3, 'i', 'n', 'g', // turning
+    4, 2, 'e', 'd', // turned
+    // 196
+    0, 3, 'f', 'e', 'w', // few
+    3, 2, 'e', 'r', // fewer
+    4, 2, 's', 't', // fewest
+    // 197
+    0, 5, 'g', 'r', 'o', 'u', 'p', // group
+    5, 1, 's', // groups
+    5, 3, 'i', 'n', 'g', // grouping
+    5, 2, 'e', 'd', // grouped
+    // 198
+    0, 4, 's', 'u', 'c', 'h', // such
+    // 199
+    0, 4, 'f', 'a', 'c', 't', // fact
+    4, 1, 's', // facts
+    // 200
+    0, 7, 'a', 'g', 'a', 'i', 'n', 's', 't', // against
+    // 201
+    0, 4, 'c', 'a', 's', 'e', // case
+    4, 1, 's', // cases
+    // 202
+    0, 6, 'a', 'r', 'o', 'u', 'n', 'd', // around
+    // 203
+    0, 6, 'u', 'p', 'd', 'a', 't', 'e', // update
+    6, 1, 's', // updates
+    5, 3, 'i', 'n', 'g', // updating
+    5, 2, 'e', 'd', // updated
+    // 204
+    0, 7, 'u', 'p', 'g', 'r', 'a', 'd', 'e', // upgrade
+    7, 1, 's', // upgrades
+    6, 3, 'i', 'n', 'g', // upgrading
+    6, 2, 'e', 'd', // upgraded
+    // 205
+    0, 7, 'c', 'o', 'm', 'p', 'a', 'n', 'y', // company
+    6, 3, 'i', 'e', 's', // companies
+    // 206
+    0, 6, 's', 'y', 's', 't', 'e', 'm', // system
+    6, 1, 's', // systems
+    // 207
+    0, 4, 'e', 'a', 'c', 'h', // each
+    // 208
+    0, 7, 'p', 'r', 'o', 'g', 'r', 'a', 'm', // program
+    7, 1, 's', // programs
+    7, 4, 'm', 'i', 'n', 'g', // programming
+    8, 2, 'e', 'd', // programmed
+    // 209
+    0, 8, 'q', 'u', 'e', 's', 't', 'i', 'o', 'n', // question
+    8, 1, 's', // questions
+    // 210
+    0, 6, 'd', 'u', 'r', 'i', 'n', 'g', // during
+    // 211
+    0, 5, 'c', 'h', 'o', 'r', 'd', // chord
+    5, 1, 's', // chords
+    5, 3, 'i', 'n', 'g', // chording
+    5, 2, 'e', 'd', // chorded
+    5, 4, 'a', 'b', 'l', 'e', // chordable
+    // 212
+    0, 3, 'r', 'u', 'n', // run
+    3, 1, 's', // runs
+    3, 4, 'n', 'i', 'n', 'g', // running
+    1, 2, 'a', 'n', // ran
+    // 213
+    0, 5, 's', 'm', 'a', 'l', 'l', // small
+    5, 2, 'e', 'r', // smaller
+    6, 2, 's', 't', // smallest
+    // 214
+    0, 6, 'n', 'u', 'm', 'b', 'e', 'r', // number
+    6, 1, 's', // numbers
+    // 215
+    0, 8, 'f', 'a', 'v', 'o', 'r', 'i', 't', 'e', // favorite
+    8, 1, 's', // favorites
+    // 216
+    0, 4, 'm', 'o', 'v', 'e', // move
+    4, 1, 's', // moves
+    3, 3, 'i', 'n', 'g', // moving
+    3, 2, 'e', 'd', // moved
+    // 217
+    0, 5, 'n', 'i', 'g', 'h', 't', // night
+    5, 1, 's', // nights
+    // 218
+    0, 4, 'l', 'i', 'v', 'e', // live
+    4, 1, 's', // lives
+    3, 3, 'i', 'n', 'g', // living
+    3, 2, 'e', 'd', // lived
+    // 219
+    0, 7, 'r', 'e', 'p', 'l', 'a', 'c', 'e', // replace
+    7, 1, 's', // replaces
+    6, 3, 'i', 'n', 'g', // replacing
+    6, 2, 'e', 'd', // replaced
+    // 220
+    0, 4, 'h', 'o', 'l', 'd', // hold
+    4, 1, 's', // holds
+    4, 3, 'i', 'n', 'g', // holding
+    1, 3, 'e', 'l', 'd', // held
+    // 221
+    0, 5, 't', 'o', 'd', 'a', 'y', // today
+    // 222
+    0, 5, 'b', 'r', 'i', 'n', 'g', // bring
+    5, 1, 's', // brings
+    5, 3, 'i', 'n', 'g', // bringing
+    2, 5, 'o', 'u', 'g', 'h', 't', // brought
+    // 223
+    0, 4, 'n', 'e', 'x', 't', // next
+    // 224
+    0, 7, 'w', 'i', 't', 'h', 'o', 'u', 't', // without
+    // 225
+    0, 6, 'b', 'e', 'f', 'o', 'r', 'e', // before
+    // 226
+    0, 5, 'l', 'a', 'r', 'g', 'e', // large
+    5, 1, 'r', // larger
+    5, 2, 's', 't', // largest
+    // 227
+    0, 4, 'm', 'u', 's', 't', // must
+    // 228
+    0, 4, 'h', 'o', 'm', 'e', // home
+    4, 1, 's', // homes
+    // 229
+    0, 5, 'u', 'n', 'd', 'e', 'r', // under
+    // 230
+    0, 5, 'w', 'a', 't', 'e', 'r', // water
+    // 231
+    0, 4, 'r', 'o', 'o', 'm', // room
+    4, 1, 's', // rooms
+    // 232
+    0, 5, 'w', 'r', 'i', 't', 'e', // write
+    5, 1, 's', // writes
+    4, 3, 'i', 'n', 'g', // writing
+    2, 3, 'o', 't', 'e', // wrote
+    // 233
+    0, 4, 'a', 'r', 'e', 'a', // area
+    4, 1, 's', // areas
+    // 234
+    0, 8, 'n', 'a', 't', 'i', 'o', 'n', 'a', 'l', // national
+    // 235
+    0, 5, 'm', 'o', 'n', 'e', 'y', // money
+    // 236
+    0, 5, 's', 't', 'o', 'r', 'y', // story
+    4, 3, 'i', 'e', 's', // stories
+    // 237
+    0, 5, 'y', 'o', 'u', 'n', 'g', // young
+    5, 2, 'e', 'r', // younger
+    6, 2, 's', 't', // youngest
+    // 238
+    0, 5, 'm', 'o', 'n', 't', 'h', // month
+    5, 1, 's', // months
+    // 239
+    0, 9, 'd', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 't', // different
+    9, 2, 'l', 'y', // differently
+    // 240
+    0, 6, 's', 't', 'a', 't', 'u', 's', // status
+    6, 2, 'e', 's', // statuses
+    // 241
+    0, 9, 'a', 'u', 't', 'o', 'm', 'a', 't', 'i', 'c', // automatic
+    9, 4, 'a', 'l', 'l', 'y', // automatically
+    // 242
+    0, 6, 'e', 'n', 'a', 'b', 'l', 'e', // enable
+    6, 1, 's', // enables
+    5, 3, 'i', 'n', 'g', // enabling
+    5, 2, 'e', 'd', // enabled
+    // 243
+    0, 3, 'l', 'o', 't', // lot
+    3, 1, 's', // lots
+    // 244
+    0, 5, 's', 't', 'u', 'd', 'y', // study
+    4, 3, 'i', 'e', 's', // studies
+    4, 4, 'y', 'i', 'n', 'g', // studying
+    4, 3, 'i', 'e', 'd', // studied
+    // 245
+    0, 4, 'b', 'o', 'o', 'k', // book
+    4, 1, 's', // books
+    // 246
+    0, 3, 'j', 'o', 'b', // job
+    3, 1, 's', // jobs
+    // 247
+    0, 4, 'w', 'o', 'r', 'd', // word
+    4, 1, 's', // words
+    // 248
+    0, 6, 't', 'h', 'o', 'u', 'g', 'h', // though
+    // 249
+    0, 8, 'b', 'u', 's', 'i', 'n', 'e', 's', 's', // business
+    8, 2, 'e', 's', // businesses
+    // 250
+    0, 5, 'i', 's', 's', 'u', 'e', // issue
+    5, 1, 's', // issues
+    // 251
+    0, 4, 's', 'i', 'd', 'e', // side
+    4, 1, 's', // sides
+    // 252
+    0, 4, 'k', 'i', 'n', 'd', // kind
+    4, 1, 's', // kinds
+    // 253
+    0, 4, 'f', 'o', 'u', 'r', // four
+    // 254
+    0, 4, 'h', 'e', 'a', 'd', // head
+    4, 1, 's', // heads
+    4, 3, 'i', 'n', 'g', // heading
+    4, 2, 'e', 'd', // headed
+    // 255
+    0, 3, 'f', 'a', 'r', // far
+    3, 4, 't', 'h', 'e', 'r', // farther
+    6, 2, 's', 't', // farthest
+    // 256
+    0, 5, 'b', 'l', 'a', 'c', 'k', // black
+    5, 1, 's', // blacks
+    5, 2, 'e', 'd', // blacked
+    5, 3, 'i', 'n', 'g', // blacking
+    // 257
+    0, 4, 'l', 'o', 'n', 'g', // long
+    4, 2, 'e', 'r', // longer
+    5, 2, 's', 't', // longest
+    // 258
+    0, 4, 'b', 'o', 't', 'h', // both
+    // 259
+    0, 6, 'l', 'i', 't', 't', 'l', 'e', // little
+    1, 3, 'e', 's', 's', // less
+    2, 3, 'a', 's', 't', // least
+    // 260
+    0, 5, 's', 'i', 'n', 'c', 'e', // since
+    // 261
+    0, 7, 'p', 'r', 'o', 'v', 'i', 'd', 'e', // provide
+    7, 1, 's', // provides
+    6, 3, 'i', 'n', 'g', // providing
+    6, 2, 'e', 'd', // provided
+    // 262
+    0, 7, 's', 'e', 'r', 'v', 'i', 'c', 'e', // service
+    7, 1, 's', // services
+    // 263
+    0, 6, 'f', 'r', 'i', 'e', 'n', 'd', // friend
+    6, 1, 's', // friends
+    6, 3, 'i', 'n', 'g', // friending
+    6, 2, 'e', 'd', // friended
+    // 264
+    0, 9, 'i', 'm', 'p', 'o', 'r', 't', 'a', 'n', 't', // important
+    // 265
+    0, 6, 'f', 'a', 't', 'h', 'e', 'r', // father
+    6, 1, 's', // fathers
+    // 266
+    0, 3, 's', 'i', 't', // sit
+    3, 1, 's', // sits
+    3, 4, 't', 'i', 'n', 'g', // sitting
+    1, 2, 'a', 't', // sat
+    // 267
+    0, 4, 'a', 'w', 'a', 'y', // away
+    // 268
+    0, 5, 'u', 'n', 't', 'i', 'l', // until
+    // 269
+    0, 5, 'p', 'o', 'w', 'e', 'r', // power
+    5, 1, 's', // powers
+    5, 3, 'i', 'n', 'g', // powering
+    5, 2, 'e', 'd', // powered
+    // 270
+    0, 4, 'h', 'o', 'u', 'r', // hour
+    4, 1, 's', // hours
+    // 271
+    0, 4, 'g', 'a', 'm', 'e', // game
+    4, 1, 's', // games
+    // 272
+    0, 5, 'o', 'f', 't', 'e', 'n', // often
+    // 273
+    0, 3, 'y', 'e', 't', // yet
+    // 274
+    0, 4, 'l', 'i', 'n', 'e', // line
+    4, 1, 's', // lines
+    3, 3, 'i', 'n', 'g', // lining
+    3, 2, 'e', 'd', // lined
+    // 275
+    0, 3, 'e', 'n', 'd', // end
+    3, 1, 's', // ends
+    3, 3, 'i', 'n', 'g', // ending
+    3, 2, 'e', 'd', // ended
+    // 276
+    0, 5, 'a', 'm', 'o', 'n', 'g', // among
+    // 277
+    0, 4, 'e', 'v', 'e', 'r', // ever
+    // 278
+    0, 5, 's', 't', 'a', 'n', 'd', // stand
+    5, 1, 's', // stands
+    5, 3, 'i', 'n', 'g', // standing
+    2, 3, 'o', 'o', 'd', // stood
+    // 279
+    0, 3, 'b', 'a', 'd', // bad
+    0, 5, 'w', 'o', 'r', 's', 'e', // worse
+    4, 1, 't', // worst
+    // 280
+    0, 4, 'l', 'o', 's', 'e', // lose
+    4, 1, 's', // loses
+    3, 3, 'i', 'n', 'g', // losing
+    3, 1, 't', // lost
+    // 281
+    0, 7, 'h', 'o', 'w', 'e', 'v', 'e', 'r', // however
+    // 282
+    0, 6, 'm', 'e', 'm', 'b', 'e', 'r', // member
+    6, 1, 's', // members
+    // 283
+    0, 3, 'p', 'a', 'y', // pay
+    3, 1, 's', // pays
+    3, 3, 'i', 'n', 'g', // paying
+    2, 2, 'i', 'd', // paid
+    // 284
+    0, 3, 'l', 'a', 'w', // law
+    3, 1, 's', // laws
+    // 285
+    0, 4, 'm', 'e', 'e', 't', // meet
+    4, 1, 's', // meets
+    4, 3, 'i', 'n', 'g', // meeting
+    2, 1, 't', // met
+    // 286
+    0, 3, 'c', 'a', 'r', // car
+    3, 1, 's', // cars
+    // 287
+    0, 4, 'c', 'i', 't', 'y', // city
+    3, 3, 'i', 'e', 's', // cities
+    // 288
+    0, 6, 'a', 'l', 'm', 'o', 's', 't', // almost
+    // 289
+    0, 7, 'i', 'n', 'c', 'l', 'u', 'd', 'e', // include
+    7, 1, 's', // includes
+    6, 3, 'i', 'n', 'g', // including
+    6, 2, 'e', 'd', // included
+    // 290
+    0, 8, 'c', 'o', 'n', 't', 'i', 'n', 'u', 'e', // continue
+    8, 1, 's', // continues
+    7, 3, 'i', 'n', 'g', // continuing
+    7, 2, 'e', 'd', // continued
+    // 291
+    0, 3, 's', 'e', 't', // set
+    3, 1, 's', // sets
+    3, 4, 't', 'i', 'n', 'g', // setting
+    3, 0, // set
+    // 292
+    0, 5, 'l', 'a', 't', 'e', 'r', // later
+    // 293
+    0, 9, 'c', 'o', 'm', 'm', 'u', 'n', 'i', 't', 'y', // community
+    8, 3, 'i', 'e', 's', // communities
+    // 294
+    0, 4, 'n', 'a', 'm', 'e', // name
+    4, 1, 's', // names
+    3, 3, 'i', 'n', 'g', // naming
+    3, 2, 'e', 'd', // named
+    // 295
+    0, 4, 'f', 'i', 'v', 'e', // five
+    // 296
+    0, 4, 'o', 'n', 'c', 'e', // once
+    // 297
+    0, 5, 'w', 'h', 'i', 't', 'e', // white
+    5, 1, 'r', // whiter
+    5, 2, 's', 't', // whitest
+    // 298
+    0, 5, 'l', 'e', 'a', 's', 't', // least
+    // 299
+    0, 5, 'l', 'e', 'a', 'r', 'n', // learn
+    5, 1, 's', // learns
+    5, 3, 'i', 'n', 'g', // learning
+    5, 2, 'e', 'd', // learned
+    // 300
+    0, 4, 'r', 'e', 'a', 'l', // real
+    // 301
+    0, 6, 'c', 'h', 'a', 'n', 'g', 'e', // change
+    6, 1, 's', // changes
+    5, 3, 'i', 'n', 'g', // changing
+    5, 2, 'e', 'd', // changed
+    // 302
+    0, 4, 't', 'e', 'a', 'm', // team
+    4, 1, 's', // teams
+    // 303
+    0, 6, 'm', 'i', 'n', 'u', 't', 'e', // minute
+    6, 1, 's', // minutes
+    // 304
+    0, 7, 's', 'e', 'v', 'e', 'r', 'a', 'l', // several
+    // 305
+    0, 4, 'i', 'd', 'e', 'a', // idea
+    4, 1, 's', // ideas
+    // 306
+    0, 3, 'k', 'i', 'd', // kid
+    3, 1, 's', // kids
+    // 307
+    0, 4, 'b', 'o', 'd', 'y', // body
+    3, 3, 'i', 'e', 's', // bodies
+    // 308
+    0, 11, 'i', 'n', 'f', 'o', 'r', 'm', 'a', 't', 'i', 'o', 'n', // information
+    // 309
+    0, 7, 'n', 'o', 't', 'h', 'i', 'n', 'g', // nothing
+    // 310
+    0, 3, 'a', 'g', 'o', // ago
+    // 311
+    0, 4, 'l', 'e', 'a', 'd', // lead
+    4, 1, 's', // leads
+    4, 3, 'i', 'n', 'g', // leading
+    2, 1, 'd', // led
+    // 312
+    0, 6, 's', 'o', 'c', 'i', 'a', 'l', // social
+    // 313
+    0, 10, 'u', 'n', 'd', 'e', 'r', 's', 't', 'a', 'n', 'd', // understand
+    10, 1, 's', // understands
+    10, 3, 'i', 'n', 'g', // understanding
+    7, 3, 'o', 'o', 'd', // understood
+    // 314
+    0, 7, 'w', 'h', 'e', 't', 'h', 'e', 'r', // whether
+    // 315
+    0, 5, 'w', 'a', 't', 'c', 'h', // watch
+    5, 2, 'e', 's', // watches
+    5, 3, 'i', 'n', 'g', // watching
+    5, 2, 'e', 'd', // watched
+    // 316
+    0, 8, 't', 'o', 'g', 'e', 't', 'h', 'e', 'r', // together
+    // 317
+    0, 6, 'f', 'o', 'l', 'l', 'o', 'w', // follow
+    6, 1, 's', // follows
+    6, 3, 'i', 'n', 'g', // following
+    6, 2, 'e', 'd', // followed
+    // 318
+    0, 6, 'p', 'a', 'r', 'e', 'n', 't', // parent
+    6, 1, 's', // parents
+    // 319
+    0, 4, 's', 't', 'o', 'p', // stop
+    4, 1, 's', // stops
+    4, 4, 'p', 'i', 'n', 'g', // stopping
+    5, 2, 'e', 'd', // stopped
+    // 320
+    0, 4, 'f', 'a', 'c', 'e', // face
+    4, 1, 's', // faces
+    3, 3, 'i', 'n', 'g', // facing
+    3, 2, 'e', 'd', // faced
+    // 321
+    0, 6, 'c', 'r', 'e', 'a', 't', 'e', // create
+    6, 1, 's', // creates
+    5, 3, 'i', 'n', 'g', // creating
+    5, 2, 'e', 'd', // created
+    // 322
+    0, 6, 'p', 'u', 'b', 'l', 'i', 'c', // public
+    // 323
+    0, 7, 'a', 'l', 'r', 'e', 'a', 'd', 'y', // already
+    // 324
+    0, 5, 's', 'p', 'e', 'a', 'k', // speak
+    5, 1, 's', // speaks
+    5, 3, 'i', 'n', 'g', // speaking
+    2, 3, 'o', 'k', 'e', // spoke
+    // 325
+    0, 4, 'r', 'e', 'a', 'd', // read
+    4, 1, 's', // reads
+    4, 3, 'i', 'n', 'g', // reading
+    4, 0, // read
+    // 326
+    0, 5, 'l', 'e', 'v', 'e', 'l', // level
+    5, 1, 's', // levels
+    5, 3, 'i', 'n', 'g', // leveling
+    5, 2, 'e', 'd', // leveled
+    // 327
+    0, 5, 'a', 'l', 'l', 'o', 'w', // allow
+    5, 1, 's', // allows
+    5, 3, 'i', 'n', 'g', // allowing
+    5, 2, 'e', 'd', // allowed
+    // 328
+    0, 3, 'a', 'd', 'd', // add
+    3, 1, 's', // adds
+    3, 3, 'i', 'n', 'g', // adding
+    3, 2, 'e', 'd', // added
+    // 329
+    0, 6, 'o', 'f', 'f', 'i', 'c', 'e', // office
+    6, 1, 's', // offices
+    // 330
+    0, 5, 's', 'p', 'e', 'n', 'd', // spend
+    5, 1, 's', // spends
+    5, 3, 'i', 'n', 'g', // spending
+    4, 1, 't', // spent
+    // 331
+    0, 4, 'd', 'o', 'n', 'e', // done
+    // 332
+    0, 5, 'o', 'r', 'd', 'e', 'r', // order
+    5, 1, 's', // orders
+    5, 3, 'i', 'n', 'g', // ordering
+    5, 2, 'e', 'd', // ordered
+    // 333
+    0, 4, 'd', 'o', 'o', 'r', // door
+    4, 1, 's', // doors
+    // 334
+    0, 6, 'h', 'e', 'a', 'l', 't', 'h', // health
+    // 335
+    0, 6, 'p', 'e', 'r', 's', 'o', 'n', // person
+    2, 4, 'o', 'p', 'l', 'e', // people
+    // 336
+    0, 4, 's', 'u', 'r', 'e', // sure
+    4, 1, 'r', // surer
+    4, 2, 's', 't', // surest
+    // 337
+    0, 7, 'h', 'i', 's', 't', 'o', 'r', 'y', // history
+    6, 3, 'i', 'e', 's', // histories
+    // 338
+    0, 5, 'p', 'a', 'r', 't', 'y', // party
+    4, 3, 'i', 'e', 's', // parties
+    // 339
+    0, 6, 'w', 'i', 't', 'h', 'i', 'n', // within
+    // 340
+    0, 4, 'g', 'r', 'o', 'w', // grow
+    4, 1, 's', // grows
+    4, 3, 'i', 'n', 'g', // growing
+    2, 2, 'e', 'w', // grew
+    // 341
+    0, 6, 'r', 'e', 's', 'u', 'l', 't', // result
+    6, 1, 's', // results
+    6, 3, 'i', 'n', 'g', // resulting
+    6, 2, 'e', 'd', // resulted
+    // 342
+    0, 4, 'o', 'p', 'e', 'n', // open
+    4, 1, 's', // opens
+    4, 3, 'i', 'n', 'g', // opening
+    4, 2, 'e', 'd', // opened
+    // 343
+    0, 7, 'm', 'o', 'r', 'n', 'i', 'n', 'g', // morning
+    7, 1, 's', // mornings
+    // 344
+    0, 4, 'w', 'a', 'l', 'k', // walk
+    4, 1, 's', // walks
+    4, 3, 'i', 'n', 'g', // walking
+    4, 2, 'e', 'd', // walked
+    // 345
+    0, 6, 'r', 'e', 'a', 's', 'o', 'n', // reason
+    6, 1, 's', // reasons
+    6, 3, 'i', 'n', 'g', // reasoning
+    6, 2, 'e', 'd', // reasoned
+    // 346
+    0, 3, 'l', 'o', 'w', // low
+    3, 2, 'e', 'r', // lower
+    4, 2, 's', 't', // lowest
+    // 347
+    0, 3, 'w', 'i', 'n', // win
+    3, 1, 's', // wins
+    3, 4, 'n', 'i', 'n', 'g', // winning
+    1, 2, 'o', 'n', // won
+    // 348
+    0, 8, 'r', 'e', 's', 'e', 'a', 'r', 'c', 'h', // research
+    8, 2, 'e', 's', // researches
+    8, 3, 'i', 'n', 'g', // researching
+    8, 2, 'e', 'd', // researched
+    // 349
+    0, 4, 'g', 'i', 'r', 'l', // girl
+    4, 1, 's', // girls
+    // 350
+    0, 3, 'g', 'u', 'y', // guy
+    3, 1, 's', // guys
+    // 351
+    0, 5, 'e', 'a', 'r', 'l', 'y', // early
+    4, 3, 'i', 'e', 'r', // earlier
+    6, 2, 's', 't', // earliest
+    // 352
+    0, 4, 'f', 'o', 'o', 'd', // food
+    4, 1, 's', // foods
+    // 353
+    0, 6, 'm', 'o', 'm', 'e', 'n', 't', // moment
+    6, 1, 's', // moments
+    // 354
+    0, 7, 'h', 'i', 'm', 's', 'e', 'l', 'f', // himself
+    // 355
+    0, 3, 'a', 'i', 'r', // air
+    3, 1, 's', // airs
+    3, 3, 'i', 'n', 'g', // airing
+    3, 2, 'e', 'd', // aired
+    // 356
+    0, 5, 'f', 'o', 'r', 'c', 'e', // force
+    5, 1, 's', // forces
+    4, 3, 'i', 'n', 'g', // forcing
+    4, 2, 'e', 'd', // forced
+    // 357
+    0, 5, 'o', 'f', 'f', 'e', 'r', // offer
+    5, 1, 's', // offers
+    5, 3, 'i', 'n', 'g', // offering
+    5, 2, 'e', 'd', // offered
+    // 358
+    0, 6, 'e', 'n', 'o', 'u', 'g', 'h', // enough
+    // 359
+    0, 8, 'a', 'l', 't', 'h', 'o', 'u', 'g', 'h', // although
+    // 360
+    0, 8, 'r', 'e', 'm', 'e', 'm', 'b', 'e', 'r', // remember
+    8, 1, 's', // remembers
+    8, 3, 'i', 'n', 'g', // remembering
+    8, 2, 'e', 'd', // remembered
+    // 361
+    0, 6, 's', 'e', 'c', 'o', 'n', 'd', // second
+    6, 1, 's', // seconds
+    // 362
+    0, 3, 'b', 'o', 'y', // boy
+    3, 1, 's', // boys
+    // 363
+    0, 5, 'm', 'a', 'y', 'b', 'e', // maybe
+    // 364
+    0, 6, 't', 'o', 'w', 'a', 'r', 'd', // toward
+    // 365
+    0, 4, 'a', 'b', 'l', 'e', // able
+    // 366
+    0, 3, 'a', 'g', 'e', // age
+    3, 1, 's', // ages
+    2, 3, 'i', 'n', 'g', // aging
+    2, 2, 'e', 'd', // aged
+    // 367
+    0, 10, 'e', 'v', 'e', 'r', 'y', 't', 'h', 'i', 'n', 'g', // everything
+    // 368
+    0, 4, 'l', 'o', 'v', 'e', // love
+    4, 1, 's', // loves
+    3, 3, 'i', 'n', 'g', // loving
+    3, 2, 'e', 'd', // loved
+    // 369
+    0, 7, 'p', 'r', 'o', 'c', 'e', 's', 's', // process
+    7, 2, 'e', 's', // processes
+    7, 3, 'i', 'n', 'g', // processing
+    7, 2, 'e', 'd', // processed
+    // 370
+    0, 5, 'i', 'n', 'p', 'u', 't', // input
+    5, 1, 's', // inputs
+    // 371
+    0, 6, 'o', 'u', 't', 'p', 'u', 't', // output
+    6, 1, 's', // outputs
+    // 372
+    0, 6, 'h', 'e', 'a', 'd', 'e', 'r', // header
+    6, 1, 's', // headers
+    // 373
+    0, 4, 't', 'm', 'u', 'x', // tmux
+    // 374
+    0, 9, 'q', 'u', 'a', 'l', 'i', 'f', 'i', 'e', 'r', // qualifier
+    // 375
+    0, 5, 'e', 'r', 'r', 'o', 'r', // error
+    5, 1, 's', // errors
+    // 376
+    0, 4, 'c', 'o', 'd', 'e', // code
+    3, 3, 'i', 'n', 'g', // coding
+    3, 2, 'e', 's', // codes
+    4, 1, 'd', // coded
+    // 377
+    0, 6, 'm', 'e', 't', 'h', 'o', 'd', // method
+    6, 1, 's', // methods
+    // 378
+    0, 6, 'o', 'b', 'j', 'e', 'c', 't', // object
+    6, 1, 's', // objects
+    // 379
+    0, 8, 'v', 'a', 'r', 'i', 'a', 'b', 'l', 'e', // variable
+    8, 1, 's', // variables
+    // 380
+    0, 5, 'a', 'r', 'r', 'a', 'y', // array
+    5, 1, 's', // arrays
+    // 381
+    0, 7, 'r', 'e', 'q', 'u', 'e', 's', 't', // request
+    7, 1, 's', // requests
+    7, 2, 'e', 'd', // requested
+    // 382
+    0, 8, 'r', 'e', 's', 'p', 'o', 'n', 's', 'e', // response
+    8, 1, 's', // responses
+    6, 3, 'd', 'e', 'd', // responded
+    // 383
+    0, 6, 'a', 'c', 'c', 'e', 's', 's', // access
+    6, 2, 'e', 'd', // accessed
+    7, 1, 's', // accesses
+    // 384
+    0, 8, 'd', 'a', 't', 'a', 'b', 'a', 's', 'e', // database
+    8, 1, 's', // databases
+    // 385
+    0, 6, 's', 'e', 'r', 'v', 'e', 'r', // server
+    6, 1, 's', // servers
+    6, 0, // server
+    // 386
+    0, 3, 'l', 'o', 'g', // log
+    3, 2, 'i', 'n', // login
+    // 387
+    0, 7, 'c', 'o', 'n', 'n', 'e', 'c', 't', // connect
+    7, 1, 's', // connects
+    7, 3, 'i', 'n', 'g', // connecting
+    // 388
+    0, 3, 'n', 'i', 'x', // nix
+    3, 2, 'o', 's', // nixos
+    // 389
+    0, 6, 'd', 'o', 'c', 'k', 'e', 'r', // docker
+    // 390
+    0, 4, 'r', 'u', 'b', 'y', // ruby
+    // 391
+    0, 6, 'p', 'y', 't', 'h', 'o', 'n', // python
+    // 392
+    0, 10, 'j', 'a', 'v', 'a', 's', 'c', 'r', 'i', 'p', 't', // javascript
+    // 393
+    0, 6, 'c', 'o', 'n', 'f', 'i', 'g', // config
+    6, 7, 'u', 'r', 'a', 't', 'i', 'o', 'n', // configuration
+    8, 1, 'e', // configure
+    9, 1, 'd', // configured
+    // 394
+    0, 4, 'l', 'o', 'a', 'd', // load
+    4, 3, 'i', 'n', 'g', // loading
+    4, 1, 's', // loads
+    4, 2, 'e', 'd', // loaded
+    // 395
+    0, 4, 's', 'a', 'v', 'e', // save
+    4, 1, 'd', // saved
+    3, 3, 'i', 'n', 'g', // saving
+    3, 2, 'e', 's', // saves
+    // 396
+    0, 4, 'u', 's', 'e', 'r', // user
+    4, 1, 's', // users
+    // 397
+    0, 5, 'a', 'd', 'm', 'i', 'n', // admin
+    5, 1, 's', // admins
+    // 398
+    0, 6, 'd', 'e', 'p', 'l', 'o', 'y', // deploy
+    // 399
+    0, 6, 'm', 'o', 'd', 'u', 'l', 'e', // module
+    6, 1, 's', // modules
+    // 400
+    0, 4, 'f', 'a', 'i', 'l', // fail
+    4, 1, 's', // fails
+    4, 3, 'i', 'n', 'g', // failing
+    4, 2, 'e', 'd', // failed
+    // 401
+    0, 5, 'm', 'u', 's', 'i', 'c', // music
+    // 402
+    0, 8, 'c', 'o', 'n', 's', 'i', 'd', 'e', 'r', // consider
+    8, 1, 's', // considers
+    8, 3, 'i', 'n', 'g', // considering
+    8, 2, 'e', 'd', // considered
+    // 403
+    0, 6, 'a', 'p', 'p', 'e', 'a', 'r', // appear
+    6, 1, 's', // appears
+    6, 3, 'i', 'n', 'g', // appearing
+    6, 2, 'e', 'd', // appeared
+    // 404
+    0, 3, 'b', 'u', 'y', // buy
+    3, 1, 's', // buys
+    3, 3, 'i', 'n', 'g', // buying
+    1, 5, 'o', 'u', 'g', 'h', 't', // bought
+    // 405
+    0, 8, 'p', 'r', 'o', 'b', 'a', 'b', 'l', 'y', // probably
+    // 406
+    0, 5, 'h', 'u', 'm', 'a', 'n', // human
+    5, 1, 's', // humans
+    // 407
+    0, 4, 'w', 'a', 'i', 't', // wait
+    4, 1, 's', // waits
+    4, 3, 'i', 'n', 'g', // waiting
+    4, 2, 'e', 'd', // waited
+    // 408
+    0, 5, 's', 'e', 'r', 'v', 'e', // serve
+    5, 1, 's', // serves
+    4, 3, 'i', 'n', 'g', // serving
+    4, 2, 'e', 'd', // served
+    // 409
+    0, 6, 'm', 'a', 'r', 'k', 'e', 't', // market
+    6, 1, 's', // markets
+    6, 3, 'i', 'n', 'g', // marketing
+    6, 2, 'e', 'd', // marketed
+    // 410
+    0, 3, 'd', 'i', 'e', // die
+    3, 1, 's', // dies
+    1, 4, 'y', 'i', 'n', 'g', // dying
+    1, 3, 'i', 'e', 'd', // died
+    // 411
+    0, 4, 's', 'e', 'n', 'd', // send
+    4, 1, 's', // sends
+    4, 3, 'i', 'n', 'g', // sending
+    3, 1, 't', // sent
+    // 412
+    0, 6, 'e', 'x', 'p', 'e', 'c', 't', // expect
+    6, 1, 's', // expects
+    6, 3, 'i', 'n', 'g', // expecting
+    6, 2, 'e', 'd', // expected
+    // 413
+    0, 5, 's', 'e', 'n', 's', 'e', // sense
+    5, 1, 's', // senses
+    4, 3, 'i', 'n', 'g', // sensing
+    4, 2, 'e', 'd', // sensed
+    // 414
+    0, 5, 'b', 'u', 'i', 'l', 'd', // build
+    5, 1, 's', // builds
+    5, 3, 'i', 'n', 'g', // building
+    4, 1, 't', // built
+    // 415
+    0, 4, 's', 't', 'a', 'y', // stay
+    4, 1, 's', // stays
+    4, 3, 'i', 'n', 'g', // staying
+    4, 2, 'e', 'd', // stayed
+    // 416
+    0, 4, 'f', 'a', 'l', 'l', // fall
+    4, 1, 's', // falls
+    4, 3, 'i', 'n', 'g', // falling
+    1, 3, 'e', 'l', 'l', // fell
+    // 417
+    0, 4, 'p', 'l', 'a', 'n', // plan
+    4, 1, 's', // plans
+    4, 4, 'n', 'i', 'n', 'g', // planning
+    5, 2, 'e', 'd', // planned
+    // 418
+    0, 3, 'c', 'u', 't', // cut
+    3, 1, 's', // cuts
+    3, 4, 't', 'i', 'n', 'g', // cutting
+    3, 0, // cut
+    // 419
+    0, 8, 'i', 'n', 't', 'e', 'r', 'e', 's', 't', // interest
+    8, 1, 's', // interests
+    8, 3, 'i', 'n', 'g', // interesting
+    8, 2, 'e', 'd', // interested
+    // 420
+    0, 5, 'd', 'e', 'a', 't', 'h', // death
+    5, 1, 's', // deaths
+    // 421
+    0, 6, 'c', 'o', 'u', 'r', 's', 'e', // course
+    6, 1, 's', // courses
+    5, 3, 'i', 'n', 'g', // coursing
+    5, 2, 'e', 'd', // coursed
+    // 422
+    0, 7, 's', 'o', 'm', 'e', 'o', 'n', 'e', // someone
+    // 423
+    0, 10, 'e', 'x', 'p', 'e', 'r', 'i', 'e', 'n', 'c', 'e', // experience
+    10, 1, 's', // experiences
+    9, 3, 'i', 'n', 'g', // experiencing
+    9, 2, 'e', 'd', // experienced
+    // 424
+    0, 6, 'b', 'e', 'h', 'i', 'n', 'd', // behind
+    // 425
+    0, 5, 'r', 'e', 'a', 'c', 'h', // reach
+    5, 2, 'e', 's', // reaches
+    5, 3, 'i', 'n', 'g', // reaching
+    5, 2, 'e', 'd', // reached
+    // 426
+    0, 5, 'l', 'o', 'c', 'a', 'l', // local
+    // 427
+    0, 4, 'k', 'i', 'l', 'l', // kill
+    4, 1, 's', // kills
+    4, 3, 'i', 'n', 'g', // killing
+    4, 2, 'e', 'd', // killed
+    // 428
+    0, 3, 's', 'i', 'x', // six
+    // 429
+    0, 7, 'w', 'e', 'a', 't', 'h', 'e', 'r', // weather
+    7, 0, // weather
+    // 430
+    0, 8, 'm', 'a', 'r', 'a', 't', 'h', 'o', 'n', // marathon
+    8, 1, 's', // marathons
+    // 431
+    0, 5, 'c', 'h', 'e', 's', 's', // chess
+    // 432
+    0, 6, 'r', 'e', 'm', 'a', 'i', 'n', // remain
+    6, 1, 's', // remains
+    6, 3, 'i', 'n', 'g', // remaining
+    6, 2, 'e', 'd', // remained
+    // 433
+    0, 6, 'e', 'f', 'f', 'e', 'c', 't', // effect
+    6, 1, 's', // effects
+    6, 3, 'i', 'n', 'g', // effecting
+    6, 2, 'e', 'd', // effected
+    // 434
+    0, 7, 's', 'u', 'g', 'g', 'e', 's', 't', // suggest
+    7, 1, 's', // suggests
+    7, 3, 'i', 'n', 'g', // suggesting
+    7, 2, 'e', 'd', // suggested
+    // 435
+    0, 5, 'c', 'l', 'a', 's', 's', // class
+    5, 2, 'e', 's', // classes
+    // 436
+    0, 7, 'c', 'o', 'n', 't', 'r', 'o', 'l', // control
+    7, 1, 's', // controls
+    7, 4, 'l', 'i', 'n', 'g', // controlling
+    8, 2, 'e', 'd', // controlled
+    // 437
+    0, 5, 'r', 'a', 'i', 's', 'e', // raise
+    5, 1, 's', // raises
+    4, 3, 'i', 'n', 'g', // raising
+    4, 2, 'e', 'd', // raised
+    // 438
+    0, 4, 'c', 'a', 'r', 'e', // care
+    4, 1, 's', // cares
+    3, 3, 'i', 'n', 'g', // caring
+    3, 2, 'e', 'd', // cared
+    // 439
+    0, 7, 'p', 'e', 'r', 'h', 'a', 'p', 's', // perhaps
+    // 440
+    0, 4, 'l', 'a', 't', 'e', // late
+    4, 1, 'r', // later
+    4, 2, 's', 't', // latest
+    // 441
+    0, 4, 'h', 'a', 'r', 'd', // hard
+    4, 2, 'e', 'r', // harder
+    5, 2, 's', 't', // hardest
+    // 442
+    0, 5, 'f', 'i', 'e', 'l', 'd', // field
+    5, 1, 's', // fields
+    // 443
+    0, 4, 'e', 'l', 's', 'e', // else
+    // 444
+    0, 4, 'p', 'a', 's', 's', // pass
+    4, 2, 'e', 's', // passes
+    4, 3, 'i', 'n', 'g', // passing
+    4, 2, 'e', 'd', // passed
+    // 445
+    0, 6, 'f', 'o', 'r', 'm', 'e', 'r', // former
+    // 446
+    0, 4, 's', 'e', 'l', 'l', // sell
+    4, 1, 's', // sells
+    4, 3, 'i', 'n', 'g', // selling
+    1, 3, 'o', 'l', 'd', // sold
+    // 447
+    0, 5, 'm', 'a', 'j', 'o', 'r', // major
+    // 448
+    0, 9, 's', 'o', 'm', 'e', 't', 'i', 'm', 'e', 's', // sometimes
+    // 449
+    0, 7, 'r', 'e', 'q', 'u', 'i', 'r', 'e', // require
+    7, 1, 's', // requires
+    6, 3, 'i', 'n', 'g', // requiring
+    6, 2, 'e', 'd', // required
+    // 450
+    0, 5, 'a', 'l', 'o', 'n', 'g', // along
+    // 451
+    0, 7, 'd', 'e', 'v', 'e', 'l', 'o', 'p', // develop
+    7, 1, 's', // develops
+    7, 3, 'i', 'n', 'g', // developing
+    7, 2, 'e', 'd', // developed
+    7, 4, 'm', 'e', 'n', 't', // development
+    11, 1, 's', // developments
+    // 452
+    0, 5, 'f', 'a', 'l', 's', 'e', // false
+    // 453
+    0, 8, 'p', 'o', 's', 'i', 't', 'i', 'v', 'e', // positive
+    // 454
+    0, 8, 'n', 'e', 'g', 'a', 't', 'i', 'v', 'e', // negative
+    // 455
+    0, 7, 'i', 'n', 'i', 't', 'i', 'a', 'l', // initial
+    // 456
+    0, 6, 's', 'e', 'a', 'r', 'c', 'h', // search
+    6, 2, 'e', 's', // searches
+    6, 3, 'i', 'n', 'g', // searching
+    6, 2, 'e', 'd', // searched
+    // 457
+    0, 5, 'v', 'i', 's', 'i', 't', // visit
+    5, 3, 'i', 'n', 'g', // visiting
+    5, 2, 'e', 'd', // visited
+    5, 1, 's', // visits
+    // 458
+    0, 6, 'p', 'h', 'r', 'a', 's', 'e', // phrase
+    6, 1, 's', // phrases
+    5, 3, 'i', 'n', 'g', // phrasing
+    5, 2, 'e', 'd', // phrased
+    // 459
+    0, 10, 't', 'h', 'e', 'm', 's', 'e', 'l', 'v', 'e', 's', // themselves
+    // 460
+    0, 6, 'r', 'e', 'p', 'o', 'r', 't', // report
+    6, 1, 's', // reports
+    6, 3, 'i', 'n', 'g', // reporting
+    6, 2, 'e', 'd', // reported
+    // 461
+    0, 4, 'r', 'o', 'l', 'e', // role
+    4, 1, 's', // roles
+    // 462
+    0, 6, 'b', 'e', 't', 't', 'e', 'r', // better
+    // 463
+    0, 8, 'e', 'c', 'o', 'n', 'o', 'm', 'i', 'c', // economic
+    // 464
+    0, 6, 'e', 'f', 'f', 'o', 'r', 't', // effort
+    6, 1, 's', // efforts
+    // 465
+    0, 6, 'd', 'e', 'c', 'i', 'd', 'e', // decide
+    6, 1, 's', // decides
+    5, 3, 'i', 'n', 'g', // deciding
+    5, 2, 'e', 'd', // decided
+    // 466
+    0, 4, 'r', 'a', 't', 'e', // rate
+    4, 1, 's', // rates
+    3, 3, 'i', 'n', 'g', // rating
+    3, 2, 'e', 'd', // rated
+    // 467
+    0, 6, 's', 't', 'r', 'o', 'n', 'g', // strong
+    6, 2, 'e', 'r', // stronger
+    7, 2, 's', 't', // strongest
+    // 468
+    0, 8, 'p', 'o', 's', 's', 'i', 'b', 'l', 'e', // possible
+    // 469
+    0, 6, 'l', 'e', 'a', 'd', 'e', 'r', // leader
+    6, 1, 's', // leaders
+    // 470
+    0, 5, 'l', 'i', 'g', 'h', 't', // light
+    5, 1, 's', // lights
+    5, 3, 'i', 'n', 'g', // lighting
+    5, 2, 'e', 'd', // lighted
+    6, 1, 'r', // lighter
+    // 471
+    0, 4, 'd', 'a', 'r', 'k', // dark
+    4, 2, 'e', 'r', // darker
+    5, 2, 's', 't', // darkest
+    // 472
+    0, 5, 'v', 'o', 'i', 'c', 'e', // voice
+    5, 1, 's', // voices
+    4, 3, 'i', 'n', 'g', // voicing
+    4, 2, 'e', 'd', // voiced
+    // 473
+    0, 5, 'w', 'h', 'o', 'l', 'e', // whole
+    // 474
+    0, 7, 'f', 'i', 'n', 'a', 'l', 'l', 'y', // finally
+    // 475
+    0, 4, 'p', 'u', 'l', 'l', // pull
+    4, 1, 's', // pulls
+    4, 3, 'i', 'n', 'g', // pulling
+    4, 2, 'e', 'd', // pulled
+    // 476
+    0, 6, 'r', 'e', 't', 'u', 'r', 'n', // return
+    6, 1, 's', // returns
+    6, 3, 'i', 'n', 'g', // returning
+    6, 2, 'e', 'd', // returned
+    // 477
+    0, 4, 'f', 'r', 'e', 'e', // free
+    4, 1, 'r', // freer
+    4, 2, 's', 't', // freest
+    // 478
+    0, 5, 'p', 'r', 'i', 'c', 'e', // price
+    5, 1, 's', // prices
+    4, 3, 'i', 'n', 'g', // pricing
+    4, 2, 'e', 'd', // priced
+    // 479
+    0, 4, 'l', 'e', 's', 's', // less
+    4, 2, 'e', 'r', // lesser
+    // 480
+    0, 9, 'a', 'c', 'c', 'o', 'r', 'd', 'i', 'n', 'g', // according
+    // 481
+    0, 8, 'd', 'e', 'c', 'i', 's', 'i', 'o', 'n', // decision
+    8, 1, 's', // decisions
+    // 482
+    0, 7, 'e', 'x', 'p', 'l', 'a', 'i', 'n', // explain
+    7, 1, 's', // explains
+    7, 3, 'i', 'n', 'g', // explaining
+    7, 2, 'e', 'd', // explained
+    // 483
+    0, 4, 'h', 'o', 'p', 'e', // hope
+    4, 1, 's', // hopes
+    3, 3, 'i', 'n', 'g', // hoping
+    3, 2, 'e', 'd', // hoped
+    // 484
+    0, 4, 'v', 'i', 'e', 'w', // view
+    4, 1, 's', // views
+    4, 3, 'i', 'n', 'g', // viewing
+    4, 2, 'e', 'd', // viewed
+    // 485
+    0, 12, 'r', 'e', 'l', 'a', 't', 'i', 'o', 'n', 's', 'h', 'i', 'p', // relationship
+    12, 1, 's', // relationships
+    // 486
+    0, 5, 'd', 'r', 'i', 'v', 'e', // drive
+    5, 1, 's', // drives
+    4, 3, 'i', 'n', 'g', // driving
+    2, 3, 'o', 'v', 'e', // drove
+    // 487
+    0, 3, 'a', 'r', 'm', // arm
+    3, 1, 's', // arms
+    3, 3, 'i', 'n', 'g', // arming
+    3, 2, 'e', 'd', // armed
+    // 488
+    0, 4, 't', 'r', 'u', 'e', // true
+    4, 1, 'r', // truer
+    4, 2, 's', 't', // truest
+    // 489
+    0, 5, 'b', 'r', 'e', 'a', 'k', // break
+    5, 1, 's', // breaks
+    5, 3, 'i', 'n', 'g', // breaking
+    2, 3, 'o', 'k', 'e', // broke
+    // 490
+    0, 10, 'd', 'i', 'f', 'f', 'e', 'r', 'e', 'n', 'c', 'e', // difference
+    10, 1, 's', // differences
+    // 491
+    0, 5, 't', 'h', 'a', 'n', 'k', // thank
+    5, 1, 's', // thanks
+    5, 3, 'i', 'n', 'g', // thanking
+    5, 2, 'e', 'd', // thanked
+    // 492
+    0, 7, 'r', 'e', 'c', 'e', 'i', 'v', 'e', // receive
+    7, 1, 's', // receives
+    6, 3, 'i', 'n', 'g', // receiving
+    6, 2, 'e', 'd', // received
+    // 493
+    0, 5, 'v', 'a', 'l', 'u', 'e', // value
+    5, 1, 's', // values
+    4, 3, 'i', 'n', 'g', // valuing
+    4, 2, 'e', 'd', // valued
+    // 494
+    0, 13, 'i', 'n', 't', 'e', 'r', 'n', 'a', 't', 'i', 'o', 'n', 'a', 'l', // international
+    // 495
+    0, 6, 'a', 'c', 't', 'i', 'o', 'n', // action
+    6, 1, 's', // actions
+    // 496
+    0, 4, 'f', 'u', 'l', 'l', // full
+    4, 2, 'e', 'r', // fuller
+    5, 2, 's', 't', // fullest
+    // 497
+    0, 8, 'f', 'u', 'n', 'c', 't', 'i', 'o', 'n', // function
+    8, 1, 's', // functions
+    // 498
+    0, 3, 'f', 'u', 'n', // fun
+    3, 2, 'n', 'y', // funny
+    4, 3, 'i', 'e', 'r', // funnier
+    6, 2, 's', 't', // funniest
+    // 499
+    0, 6, 'r', 'e', 'm', 'o', 'v', 'e', // remove
+    6, 1, 'd', // removed
+    5, 3, 'i', 'n', 'g', // removing
+    5, 2, 'e', 's', // removes
+    // 500
+    0, 6, 'm', 'a', 'n', 'u', 'a', 'l', // manual
+    6, 2, 'l', 'y', // manually
+    // 501
+    0, 5, 'c', 'l', 'i', 'c', 'k', // click
+    5, 3, 'i', 'n', 'g', // clicking
+    5, 2, 'e', 'd', // clicked
+    5, 1, 's', // clicks
+    // 502
+    0, 6, 'b', 'u', 't', 't', 'o', 'n', // button
+    6, 1, 's', // buttons
+    // 503
+    0, 6, 'r', 'e', 'j', 'e', 'c', 't', // reject
+    6, 2, 'e', 'd', // rejected
+    6, 3, 'i', 'n', 'g', // rejecting
+    6, 1, 's', // rejects
+    // 504
+    0, 5, 'e', 'x', 'a', 'c', 't', // exact
+    5, 2, 'l', 'y', // exactly
+    // 505
+    0, 8, 's', 'e', 'n', 't', 'e', 'n', 'c', 'e', // sentence
+    8, 1, 's', // sentences
+    // 506
+    0, 5, 'm', 'o', 'd', 'e', 'l', // model
+    5, 1, 's', // models
+    5, 3, 'i', 'n', 'g', // modeling
+    5, 2, 'e', 'd', // modeled
+    // 507
+    0, 4, 'f', 'a', 's', 't', // fast
+    4, 2, 'e', 'r', // faster
+    5, 2, 's', 't', // fastest
+    // 508
+    0, 5, 's', 'o', 'r', 'r', 'y', // sorry
+    // 509
+    0, 4, 'j', 'o', 'i', 'n', // join
+    4, 1, 's', // joins
+    4, 3, 'i', 'n', 'g', // joining
+    4, 2, 'e', 'd', // joined
+    // 510
+    0, 6, 's', 'e', 'a', 's', 'o', 'n', // season
+    6, 1, 's', // seasons
+    // 511
+    0, 8, 'p', 'o', 's', 'i', 't', 'i', 'o', 'n', // position
+    8, 1, 's', // positions
+    8, 3, 'i', 'n', 'g', // positioning
+    8, 2, 'e', 'd', // positioned
+    // 512
+    0, 6, 'p', 'l', 'a', 'y', 'e', 'r', // player
+    6, 1, 's', // players
+    // 513
+    0, 5, 'a', 'g', 'r', 'e', 'e', // agree
+    5, 1, 's', // agrees
+    5, 3, 'i', 'n', 'g', // agreeing
+    5, 1, 'd', // agreed
+    // 514
+    0, 10, 'e', 's', 'p', 'e', 'c', 'i', 'a', 'l', 'l', 'y', // especially
+    // 515
+    0, 6, 'r', 'e', 'c', 'o', 'r', 'd', // record
+    6, 1, 's', // records
+    6, 3, 'i', 'n', 'g', // recording
+    6, 2, 'e', 'd', // recorded
+    // 516
+    0, 4, 'p', 'i', 'c', 'k', // pick
+    4, 1, 's', // picks
+    4, 3, 'i', 'n', 'g', // picking
+    4, 2, 'e', 'd', // picked
+    // 517
+    0, 4, 'w', 'e', 'a', 'r', // wear
+    4, 1, 's', // wears
+    4, 3, 'i', 'n', 'g', // wearing
+    1, 3, 'o', 'r', 'e', // wore
+    // 518
+    0, 7, 's', 'p', 'e', 'c', 'i', 'a', 'l', // special
+    // 519
+    0, 5, 's', 'p', 'a', 'c', 'e', // space
+    5, 1, 's', // spaces
+    4, 3, 'i', 'n', 'g', // spacing
+    4, 2, 'e', 'd', // spaced
+    // 520
+    0, 6, 'g', 'r', 'o', 'u', 'n', 'd', // ground
+    6, 1, 's', // grounds
+    6, 3, 'i', 'n', 'g', // grounding
+    6, 2, 'e', 'd', // grounded
+    // 521
+    0, 4, 'f', 'o', 'r', 'm', // form
+    4, 1, 's', // forms
+    4, 3, 'i', 'n', 'g', // forming
+    4, 2, 'e', 'd', // formed
+    // 522
+    0, 7, 's', 'u', 'p', 'p', 'o', 'r', 't', // support
+    7, 1, 's', // supports
+    7, 3, 'i', 'n', 'g', // supporting
+    7, 2, 'e', 'd', // supported
+    // 523
+    0, 5, 'e', 'v', 'e', 'n', 't', // event
+    5, 1, 's', // events
+    // 524
+    0, 8, 'o', 'f', 'f', 'i', 'c', 'i', 'a', 'l', // official
+    8, 1, 's', // officials
+    // 525
+    0, 5, 'w', 'h', 'o', 's', 'e', // whose
+    // 526
+    0, 6, 'm', 'a', 't', 't', 'e', 'r', // matter
+    6, 1, 's', // matters
+    6, 3, 'i', 'n', 'g', // mattering
+    6, 2, 'e', 'd', // mattered
+    // 527
+    0, 8, 'e', 'v', 'e', 'r', 'y', 'o', 'n', 'e', // everyone
+    // 528
+    0, 6, 'c', 'e', 'n', 't', 'e', 'r', // center
+    6, 1, 's', // centers
+    6, 3, 'i', 'n', 'g', // centering
+    6, 2, 'e', 'd', // centered
+    // 529
+    0, 4, 's', 'i', 't', 'e', // site
+    4, 1, 's', // sites
+    3, 3, 'i', 'n', 'g', // siting
+    3, 2, 'e', 'd', // sited
+    // 530
+    0, 7, 'p', 'r', 'o', 'j', 'e', 'c', 't', // project
+    7, 1, 's', // projects
+    7, 3, 'i', 'n', 'g', // projecting
+    7, 2, 'e', 'd', // projected
+    // 531
+    0, 3, 'h', 'i', 't', // hit
+    3, 1, 's', // hits
+    3, 4, 't', 'i', 'n', 'g', // hitting
+    3, 0, // hit
+    // 532
+    0, 4, 'b', 'a', 's', 'e', // base
+    4, 1, 's', // bases
+    3, 3, 'i', 'n', 'g', // basing
+    3, 2, 'e', 'd', // based
+    // 533
+    0, 8, 'a', 'c', 't', 'i', 'v', 'i', 't', 'y', // activity
+    7, 3, 'i', 'e', 's', // activities
+    // 534
+    0, 4, 's', 't', 'a', 'r', // star
+    4, 1, 's', // stars
+    4, 4, 'r', 'i', 'n', 'g', // starring
+    5, 2, 'e', 'd', // starred
+    // 535
+    0, 5, 't', 'a', 'b', 'l', 'e', // table
+    5, 1, 's', // tables
+    4, 3, 'i', 'n', 'g', // tabling
+    4, 2, 'e', 'd', // tabled
+    // 536
+    0, 7, 'p', 'r', 'o', 'd', 'u', 'c', 'e', // produce
+    7, 1, 's', // produces
+    6, 3, 'i', 'n', 'g', // producing
+    6, 2, 'e', 'd', // produced
+    // 537
+    0, 3, 'e', 'a', 't', // eat
+    3, 1, 's', // eats
+    3, 3, 'i', 'n', 'g', // eating
+    0, 3, 'a', 't', 'e', // ate
+    // 538
+    0, 5, 't', 'e', 'a', 'c', 'h', // teach
+    5, 2, 'e', 's', // teaches
+    5, 3, 'i', 'n', 'g', // teaching
+    1, 5, 'a', 'u', 'g', 'h', 't', // taught
+    // 539
+    0, 4, 'h', 'a', 'l', 'f', // half
+    3, 3, 'v', 'e', 's', // halves
+    // 540
+    0, 9, 's', 'i', 't', 'u', 'a', 't', 'i', 'o', 'n', // situation
+    9, 1, 's', // situations
+    // 541
+    0, 4, 'e', 'a', 's', 'y', // easy
+    3, 3, 'i', 'e', 'r', // easier
+    5, 2, 's', 't', // easiest
+    // 542
+    0, 4, 'c', 'o', 's', 't', // cost
+    4, 1, 's', // costs
+    4, 3, 'i', 'n', 'g', // costing
+    4, 2, 'e', 'd', // costed
+    // 543
+    0, 8, 'i', 'n', 'd', 'u', 's', 't', 'r', 'y', // industry
+    7, 3, 'i', 'e', 's', // industries
+    // 544
+    0, 6, 's', 't', 'r', 'e', 'e', 't', // street
+    6, 1, 's', // streets
+    // 545
+    0, 5, 'i', 'm', 'a', 'g', 'e', // image
+    5, 1, 's', // images
+    4, 3, 'i', 'n', 'g', // imaging
+    4, 2, 'e', 'd', // imaged
+    // 546
+    0, 6, 'i', 't', 's', 'e', 'l', 'f', // itself
+    // 547
+    0, 5, 'p', 'h', 'o', 'n', 'e', // phone
+    5, 1, 's', // phones
+    4, 3, 'i', 'n', 'g', // phoning
+    4, 2, 'e', 'd', // phoned
+    // 548
+    0, 6, 'e', 'i', 't', 'h', 'e', 'r', // either
+    // 549
+    0, 4, 'd', 'a', 't', 'a', // data
+    // 550
+    0, 5, 'c', 'o', 'v', 'e', 'r', // cover
+    5, 1, 's', // covers
+    5, 3, 'i', 'n', 'g', // covering
+    5, 2, 'e', 'd', // covered
+    // 551
+    0, 5, 'q', 'u', 'i', 't', 'e', // quite
+    // 552
+    0, 5, 'c', 'l', 'e', 'a', 'r', // clear
+    5, 1, 's', // clears
+    5, 3, 'i', 'n', 'g', // clearing
+    5, 2, 'e', 'd', // cleared
+    // 553
+    0, 8, 'p', 'r', 'a', 'c', 't', 'i', 'c', 'e', // practice
+    8, 1, 's', // practices
+    7, 3, 'i', 'n', 'g', // practicing
+    7, 2, 'e', 'd', // practiced
+    // 554
+    0, 5, 'p', 'i', 'e', 'c', 'e', // piece
+    5, 1, 's', // pieces
+    4, 3, 'i', 'n', 'g', // piecing
+    4, 2, 'e', 'd', // pieced
+    // 555
+    0, 4, 'l', 'a', 'n', 'd', // land
+    4, 1, 's', // lands
+    4, 3, 'i', 'n', 'g', // landing
+    4, 2, 'e', 'd', // landed
+    // 556
+    0, 6, 'r', 'e', 'c', 'e', 'n', 't', // recent
+    6, 2, 'l', 'y', // recently
+    // 557
+    0, 8, 'd', 'e', 's', 'c', 'r', 'i', 'b', 'e', // describe
+    8, 1, 's', // describes
+    7, 3, 'i', 'n', 'g', // describing
+    7, 2, 'e', 'd', // described
+    // 558
+    0, 7, 'p', 'r', 'o', 'd', 'u', 'c', 't', // product
+    7, 1, 's', // products
+    // 559
+    0, 4, 'w', 'a', 'l', 'l', // wall
+    4, 1, 's', // walls
+    // 560
+    0, 6, 'w', 'o', 'r', 'k', 'e', 'r', // worker
+    6, 1, 's', // workers
+    // 561
+    0, 4, 'n', 'e', 'w', 's', // news
+    // 562
+    0, 4, 't', 'e', 's', 't', // test
+    4, 1, 's', // tests
+    4, 3, 'i', 'n', 'g', // testing
+    4, 2, 'e', 'd', // tested
+    // 563
+    0, 5, 'm', 'o', 'v', 'i', 'e', // movie
+    5, 1, 's', // movies
+    // 564
+    0, 7, 'c', 'e', 'r', 't', 'a', 'i', 'n', // certain
+    7, 2, 'l', 'y', // certainly
+    // 565
+    0, 5, 'n', 'o', 'r', 't', 'h', // north
+    // 566
+    0, 5, 'i', 's', 'n', 0x27, 't', // isn't
+    // 567
+    0, 4, 'p', 'e', 'a', 'k', // peak
+    // 568
+    0, 7, 's', 'u', 'p', 'p', 'o', 's', 'e', // suppose
+    7, 1, 'd', // supposed
+    7, 1, 's', // supposes
+    6, 3, 'i', 'n', 'g', // supposing
+    // 569
+    0, 5, 'j', 'o', 'c', 'k', 'e', // jocke
+    // 570
+    0, 6, 'j', 'o', 'a', 'k', 'i', 'm', // joakim
+    // 571
+    0, 7, 'e', 'k', 's', 't', 'r', 0xF6, 'm', // ekström
+    // 572
+    0, 6, 's', 'w', 'e', 'd', 'e', 'n', // sweden
+    4, 3, 'i', 's', 'h', // swedish
+    // 573
+    0, 23, 'j', 'o', 'a', 'k', 'i', 'm', '@', 'j', 'o', 'a', 'k', 'i', 'm', 'e', 'k', 's', 't', 'r', 'o', 'm', '.', 's', 'e', // joakim@joakimekstrom.se
+    // 574
+    0, 7, 'i', 'n', 's', 't', 'e', 'a', 'd', // instead
+    // 575
+    0, 8, 'p', 'e', 'r', 's', 'o', 'n', 'a', 'l', // personal
+    // 576
+    0, 6, 's', 'i', 'm', 'p', 'l', 'y', // simply
+    // 577
+    0, 5, 't', 'h', 'i', 'r', 'd', // third
+    // 578
+    0, 10, 't', 'e', 'c', 'h', 'n', 'o', 'l', 'o', 'g', 'y', // technology
+    // 579
+    0, 5, 'c', 'a', 't', 'c', 'h', // catch
+    5, 2, 'e', 's', // catches
+    5, 3, 'i', 'n', 'g', // catching
+    2, 4, 'u', 'g', 'h', 't', // caught
+    // 580
+    0, 4, 's', 't', 'e', 'p', // step
+    4, 1, 's', // steps
+    4, 4, 'p', 'i', 'n', 'g', // stepping
+    5, 2, 'e', 'd', // stepped
+    // 581
+    0, 8, 'c', 'o', 'm', 'p', 'u', 't', 'e', 'r', // computer
+    8, 1, 's', // computers
+    // 582
+    0, 4, 't', 'y', 'p', 'e', // type
+    4, 1, 's', // types
+    3, 3, 'i', 'n', 'g', // typing
+    3, 2, 'e', 'd', // typed
+    // 583
+    0, 9, 'a', 't', 't', 'e', 'n', 't', 'i', 'o', 'n', // attention
+    // 584
+    0, 4, 'd', 'r', 'a', 'w', // draw
+    4, 1, 's', // draws
+    4, 3, 'i', 'n', 'g', // drawing
+    2, 2, 'e', 'w', // drew
+    // 585
+    0, 4, 'f', 'i', 'l', 'm', // film
+    4, 1, 's', // films
+    4, 3, 'i', 'n', 'g', // filming
+    4, 2, 'e', 'd', // filmed
+    // 586
+    0, 4, 't', 'r', 'e', 'e', // tree
+    4, 1, 's', // trees
+    // 587
+    0, 6, 's', 'o', 'u', 'r', 'c', 'e', // source
+    6, 1, 's', // sources
+    5, 3, 'i', 'n', 'g', // sourcing
+    5, 2, 'e', 'd', // sourced
+    // 588
+    0, 3, 'r', 'e', 'd', // red
+    3, 3, 'd', 'e', 'r', // redder
+    5, 2, 's', 't', // reddest
+    // 589
+    0, 6, 'n', 'e', 'a', 'r', 'l', 'y', // nearly
+    // 590
+    0, 12, 'o', 'r', 'g', 'a', 'n', 'i', 'z', 'a', 't', 'i', 'o', 'n', // organization
+    12, 1, 's', // organizations
+    // 591
+    0, 6, 'c', 'h', 'o', 'o', 's', 'e', // choose
+    6, 1, 's', // chooses
+    5, 3, 'i', 'n', 'g', // choosing
+    3, 2, 's', 'e', // chose
+    // 592
+    0, 5, 'c', 'a', 'u', 's', 'e', // cause
+    5, 1, 's', // causes
+    4, 3, 'i', 'n', 'g', // causing
+    4, 2, 'e', 'd', // caused
+    // 593
+    0, 6, 'w', 'i', 'n', 'd', 'o', 'w', // window
+    6, 1, 's', // windows
+    // 594
+    0, 9, 'd', 'i', 'f', 'f', 'i', 'c', 'u', 'l', 't', // difficult
+    // 595
+    0, 6, 'l', 'i', 's', 't', 'e', 'n', // listen
+    6, 1, 's', // listens
+    6, 3, 'i', 'n', 'g', // listening
+    6, 2, 'e', 'd', // listened
+    // 596
+    0, 4, 's', 'o', 'o', 'n', // soon
+    // 597
+    0, 6, 'c', 'h', 'a', 'n', 'c', 'e', // chance
+    6, 1, 's', // chances
+    // 598
+    0, 7, 'b', 'r', 'o', 't', 'h', 'e', 'r', // brother
+    7, 1, 's', // brothers
+    // 599
+    0, 6, 'e', 'n', 'e', 'r', 'g', 'y', // energy
+    5, 3, 'i', 'e', 's', // energies
+    // 600
+    0, 6, 'p', 'e', 'r', 'i', 'o', 'd', // period
+    6, 1, 's', // periods
+    // 601
+    0, 6, 's', 'u', 'm', 'm', 'e', 'r', // summer
+    6, 1, 's', // summers
+    // 602
+    0, 7, 'r', 'e', 'a', 'l', 'i', 'z', 'e', // realize
+    7, 1, 's', // realizes
+    6, 3, 'i', 'n', 'g', // realizing
+    6, 2, 'e', 'd', // realized
+    // 603
+    0, 9, 'a', 'v', 'a', 'i', 'l', 'a', 'b', 'l', 'e', // available
+    // 604
+    0, 6, 'l', 'i', 'k', 'e', 'l', 'y', // likely
+    // 605
+    0, 11, 'o', 'p', 'p', 'o', 'r', 't', 'u', 'n', 'i', 't', 'y', // opportunity
+    10, 3, 'i', 'e', 's', // opportunities
+    // 606
+    0, 4, 't', 'e', 'r', 'm', // term
+    4, 1, 's', // terms
+    4, 3, 'i', 'n', 'g', // terming
+    4, 2, 'e', 'd', // termed
+    // 607
+    0, 5, 's', 'h', 'o', 'r', 't', // short
+    5, 2, 'e', 'r', // shorter
+    6, 2, 's', 't', // shortest
+    // 608
+    0, 9, 'c', 'o', 'n', 'd', 'i', 't', 'i', 'o', 'n', // condition
+    9, 1, 's', // conditions
+    9, 3, 'i', 'n', 'g', // conditioning
+    9, 2, 'e', 'd', // conditioned
+    // 609
+    0, 6, 'c', 'h', 'o', 'i', 'c', 'e', // choice
+    6, 1, 's', // choices
+    // 610
+    0, 6, 's', 'i', 'n', 'g', 'l', 'e', // single
+    // 611
+    0, 4, 'r', 'u', 'l', 'e', // rule
+    4, 1, 's', // rules
+    3, 3, 'i', 'n', 'g', // ruling
+    3, 2, 'e', 'd', // ruled
+    // 612
+    0, 5, 's', 'o', 'u', 't', 'h', // south
+    // 613
+    0, 5, 'f', 'l', 'o', 'o', 'r', // floor
+    5, 1, 's', // floors
+    5, 3, 'i', 'n', 'g', // flooring
+    5, 2, 'e', 'd', // floored
+    // 614
+    0, 8, 'c', 'a', 'm', 'p', 'a', 'i', 'g', 'n', // campaign
+    8, 1, 's', // campaigns
+    8, 3, 'i', 'n', 'g', // campaigning
+    8, 2, 'e', 'd', // campaigned
+    // 615
+    0, 8, 'm', 'a', 't', 'e', 'r', 'i', 'a', 'l', // material
+    8, 1, 's', // materials
+    8, 3, 'i', 'n', 'g', // materialing
+    8, 2, 'e', 'd', // materialed
+    // 616
+    0, 10, 'p', 'o', 'p', 'u', 'l', 'a', 't', 'i', 'o', 'n', // population
+    10, 1, 's', // populations
+    // 617
+    0, 6, 'a', 'n', 'y', 'o', 'n', 'e', // anyone
+    // 618
+    0, 8, 'i', 'n', 'c', 'r', 'e', 'a', 's', 'e', // increase
+    8, 1, 's', // increases
+    7, 3, 'i', 'n', 'g', // increasing
+    7, 2, 'e', 'd', // increased
+    // 619
+    0, 3, 'p', 'e', 'r', // per
+    // 620
+    0, 5, 'c', 'l', 'o', 's', 'e', // close
+    5, 1, 's', // closes
+    4, 3, 'i', 'n', 'g', // closing
+    4, 2, 'e', 'd', // closed
+    // 621
+    0, 4, 'r', 'i', 's', 'k', // risk
+    4, 1, 's', // risks
+    4, 3, 'i', 'n', 'g', // risking
+    4, 2, 'e', 'd', // risked
+    // 622
+    0, 7, 'c', 'u', 'r', 'r', 'e', 'n', 't', // current
+    // 623
+    0, 4, 'f', 'i', 'r', 'e', // fire
+    4, 1, 's', // fires
+    3, 3, 'i', 'n', 'g', // firing
+    3, 2, 'e', 'd', // fired
+    // 624
+    0, 4, 'd', 'e', 'a', 'l', // deal
+    4, 1, 's', // deals
+    4, 3, 'i', 'n', 'g', // dealing
+    4, 1, 't', // dealt
+    // 625
+    0, 11, 'p', 'e', 'r', 'f', 'o', 'r', 'm', 'a', 'n', 'c', 'e', // performance
+    11, 1, 's', // performances
+    // 626
+    0, 6, 'f', 'u', 't', 'u', 'r', 'e', // future
+    // 627
+    0, 4, 'g', 'o', 'a', 'l', // goal
+    4, 1, 's', // goals
+    // 628
+    0, 7, 's', 'u', 'b', 'j', 'e', 'c', 't', // subject
+    7, 1, 's', // subjects
+    7, 3, 'i', 'n', 'g', // subjecting
+    7, 2, 'e', 'd', // subjected
+    // 629
+    0, 5, 's', 't', 'o', 'r', 'e', // store
+    5, 1, 's', // stores
+    4, 3, 'i', 'n', 'g', // storing
+    4, 2, 'e', 'd', // stored
+    // 630
+    0, 6, 'r', 'e', 'd', 'u', 'c', 'e', // reduce
+    6, 1, 's', // reduces
+    5, 3, 'i', 'n', 'g', // reducing
+    5, 2, 'e', 'd', // reduced
+    // 631
+    0, 5, 'w', 'r', 'o', 'n', 'g', // wrong
+    5, 2, 'e', 'r', // wronger
+    6, 2, 's', 't', // wrongest
+    // 632
+    0, 7, 'i', 'n', 'v', 'o', 'l', 'v', 'e', // involve
+    7, 1, 's', // involves
+    6, 3, 'i', 'n', 'g', // involving
+    6, 2, 'e', 'd', // involved
+    // 633
+    0, 8, 's', 'e', 'c', 'u', 'r', 'i', 't', 'y', // security
+    7, 3, 'i', 'e', 's', // securities
+    // 634
+    0, 4, 'b', 'a', 'n', 'k', // bank
+    4, 1, 's', // banks
+    4, 3, 'i', 'n', 'g', // banking
+    4, 2, 'e', 'd', // banked
+    // 635
+    0, 4, 'w', 'e', 's', 't', // west
+    // 636
+    0, 5, 's', 'p', 'o', 'r', 't', // sport
+    5, 1, 's', // sports
+    5, 3, 'i', 'n', 'g', // sporting
+    5, 2, 'e', 'd', // sported
+    // 637
+    0, 5, 'b', 'o', 'a', 'r', 'd', // board
+    5, 1, 's', // boards
+    5, 3, 'i', 'n', 'g', // boarding
+    5, 2, 'e', 'd', // boarded
+    // 638
+    0, 7, 'p', 'r', 'i', 'v', 'a', 't', 'e', // private
+    // 639
+    0, 4, 'r', 'e', 's', 't', // rest
+    4, 1, 's', // rests
+    4, 3, 'i', 'n', 'g', // resting
+    4, 2, 'e', 'd', // rested
+    // 640
+    0, 8, 'b', 'e', 'h', 'a', 'v', 'i', 'o', 'r', // behavior
+    8, 1, 's', // behaviors
+    // 641
+    0, 5, 'f', 'i', 'g', 'h', 't', // fight
+    5, 1, 's', // fights
+    5, 3, 'i', 'n', 'g', // fighting
+    1, 5, 'o', 'u', 'g', 'h', 't', // fought
+    // 642
+    0, 5, 't', 'h', 'r', 'o', 'w', // throw
+    5, 1, 's', // throws
+    5, 3, 'i', 'n', 'g', // throwing
+    3, 2, 'e', 'w', // threw
+    // 643
+    0, 3, 't', 'o', 'p', // top
+    3, 1, 's', // tops
+    3, 4, 'p', 'i', 'n', 'g', // topping
+    4, 2, 'e', 'd', // topped
+    // 644
+    0, 5, 'q', 'u', 'i', 'c', 'k', // quick
+    5, 2, 'e', 'r', // quicker
+    6, 2, 's', 't', // quickest
+    // 645
+    0, 4, ':', '+', '1', ':', // :+1:
+    // 646
+    0, 14, ':', 'r', 'a', 'i', 's', 'e', 'd', '_', 'h', 'a', 'n', 'd', 's', ':', // :raised_hands:
+    // 647
+    0, 4, 'n', 'e', 'a', 'r', // near
+    4, 2, 'e', 'r', // nearer
+    5, 2, 's', 't', // nearest
+    // 648
+    0, 6, 'c', 'o', 'm', 'm', 'o', 'n', // common
+    // 649
+    0, 4, 'r', 'a', 'c', 'e', // race
+    4, 1, 's', // races
+    3, 3, 'i', 'n', 'g', // racing
+    3, 2, 'e', 'd', // raced
+    // 650
+    0, 4, 'p', 'a', 's', 't', // past
+    // 651
+    0, 4, 'f', 'i', 'l', 'l', // fill
+    4, 1, 's', // fills
+    4, 3, 'i', 'n', 'g', // filling
+    4, 2, 'e', 'd', // filled
+    // 652
+    0, 9, 'r', 'e', 'p', 'r', 'e', 's', 'e', 'n', 't', // represent
+    9, 1, 's', // represents
+    9, 3, 'i', 'n', 'g', // representing
+    9, 2, 'e', 'd', // represented
+    // 653
+    0, 5, 'f', 'o', 'c', 'u', 's', // focus
+    5, 2, 'e', 's', // focuses
+    5, 3, 'i', 'n', 'g', // focusing
+    5, 2, 'e', 'd', // focused
+    // 654
+    0, 7, 'f', 'o', 'r', 'e', 'i', 'g', 'n', // foreign
+    // 655
+    0, 4, 'd', 'r', 'o', 'p', // drop
+    4, 1, 's', // drops
+    4, 4, 'p', 'i', 'n', 'g', // dropping
+    5, 2, 'e', 'd', // dropped
+    // 656
+    0, 4, 'u', 'p', 'o', 'n', // upon
+    // 657
+    0, 4, 'j', 'u', 'm', 'p', // jump
+    4, 1, 's', // jumps
+    4, 3, 'i', 'n', 'g', // jumping
+    4, 2, 'e', 'd', // jumped
+    // 658
+    0, 5, 'r', 'o', 'u', 'g', 'h', // rough
+    5, 2, 'e', 'r', // rougher
+    6, 2, 's', 't', // roughest
+    5, 2, 'l', 'y', // roughly
+    // 659
+    0, 4, 'f', 'a', 'i', 'r', // fair
+    4, 2, 'e', 'r', // fairer
+    5, 2, 's', 't', // fairest
+    4, 2, 'l', 'y', // fairly
+    // 660
+    0, 4, 'p', 'u', 's', 'h', // push
+    4, 2, 'e', 's', // pushes
+    4, 3, 'i', 'n', 'g', // pushing
+    4, 2, 'e', 'd', // pushed
+    // 661
+    0, 6, 'n', 'a', 't', 'u', 'r', 'e', // nature
+    5, 2, 'a', 'l', // natural
+    // 662
+    0, 5, 'c', 'o', 'l', 'o', 'r', // color
+    5, 1, 's', // colors
+    5, 3, 'i', 'n', 'g', // coloring
+    5, 2, 'e', 'd', // colored
+    // 663
+    0, 5, 's', 'o', 'u', 'n', 'd', // sound
+    5, 1, 's', // sounds
+    5, 3, 'i', 'n', 'g', // sounding
+    5, 2, 'e', 'd', // sounded
+    // 664
+    0, 4, 'n', 'o', 't', 'e', // note
+    4, 1, 's', // notes
+    3, 3, 'i', 'n', 'g', // noting
+    3, 2, 'e', 'd', // noted
+    // 665
+    0, 4, 'f', 'i', 'n', 'e', // fine
+    4, 1, 'r', // finer
+    4, 2, 's', 't', // finest
+    // 666
+    0, 8, 'm', 'o', 'v', 'e', 'm', 'e', 'n', 't', // movement
+    8, 1, 's', // movements
+    // 667
+    0, 4, 'p', 'a', 'g', 'e', // page
+    4, 1, 's', // pages
+    3, 3, 'i', 'n', 'g', // paging
+    3, 2, 'e', 'd', // paged
+    // 668
+    0, 5, 'e', 'n', 't', 'e', 'r', // enter
+    5, 1, 's', // enters
+    5, 3, 'i', 'n', 'g', // entering
+    5, 2, 'e', 'd', // entered
+    // 669
+    0, 5, 's', 'h', 'a', 'r', 'e', // share
+    5, 1, 's', // shares
+    4, 3, 'i', 'n', 'g', // sharing
+    4, 2, 'e', 'd', // shared
+    // 670
+    0, 4, 'p', 'o', 'o', 'r', // poor
+    4, 2, 'e', 'r', // poorer
+    5, 2, 's', 't', // poorest
+    // 671
+    0, 7, 'c', 'o', 'n', 'c', 'e', 'r', 'n', // concern
+    7, 1, 's', // concerns
+    7, 3, 'i', 'n', 'g', // concerning
+    7, 2, 'e', 'd', // concerned
+    // 672
+    0, 6, 's', 'e', 'r', 'i', 'e', 's', // series
+    // 673
+    0, 4, 's', 'i', 'g', 'n', // sign
+    4, 1, 's', // signs
+    4, 3, 'i', 'n', 'g', // signing
+    4, 2, 'e', 'd', // signed
+    // 674
+    0, 7, 'e', 'n', 'g', 'l', 'i', 's', 'h', // english
+    4, 3, 'a', 'n', 'd', // england
+    // 675
+    0, 6, 'm', 'o', 'n', 'd', 'a', 'y', // monday
+    6, 1, 's', // mondays
+    // 676
+    0, 7, 't', 'u', 'e', 's', 'd', 'a', 'y', // tuesday
+    7, 1, 's', // tuesdays
+    // 677
+    0, 9, 'w', 'e', 'd', 'n', 'e', 's', 'd', 'a', 'y', // wednesday
+    9, 1, 's', // wednesdays
+    // 678
+    0, 8, 't', 'h', 'u', 'r', 's', 'd', 'a', 'y', // thursday
+    8, 1, 's', // thursdays
+    // 679
+    0, 6, 'f', 'r', 'i', 'd', 'a', 'y', // friday
+    6, 1, 's', // fridays
+    // 680
+    0, 8, 's', 'a', 't', 'u', 'r', 'd', 'a', 'y', // saturday
+    8, 1, 's', // saturdays
+    // 681
+    0, 6, 's', 'u', 'n', 'd', 'a', 'y', // sunday
+    6, 1, 's', // sundays
+    // 682
+    0, 4, 's', 'o', 'r', 't', // sort
+    4, 1, 's', // sorts
+    4, 3, 'i', 'n', 'g', // sorting
+    4, 2, 'e', 'd', // sorted
+    // 683
+    0, 8, 'd', 'o', 'c', 'u', 'm', 'e', 'n', 't', // document
+    8, 1, 's', // documents
+    // 684
+    0, 7, 'd', 'o', 'e', 's', 'n', 0x27, 't', // doesn't
+    // 685
+    0, 5, 'b', 'e', 'g', 'i', 'n', // begin
+    5, 1, 's', // begins
+    3, 2, 'a', 'n', // began
+    3, 2, 'u', 'n', // begun
+    // 686
+    0, 3, 'e', 'y', 'e', // eye
+    3, 1, 's', // eyes
+    3, 1, 'd', // eyed
+    // 687
+    0, 7, 'g', 'e', 'n', 'e', 'r', 'a', 'l', // general
+    // 688
+    0, 6, 'g', 'o', 'v', 'e', 'r', 'n', // govern
+    6, 2, 'e', 'd', // governed
+    // 689
+    0, 6, 'n', 'a', 't', 'i', 'o', 'n', // nation
+    6, 1, 's', // nations
+    // 690
+    0, 7, 'p', 'r', 'e', 's', 'e', 'n', 't', // present
+    7, 2, 'e', 'd', // presented
+    7, 1, 's', // presents
+    // 691
+    0, 6, 's', 'c', 'h', 'o', 'o', 'l', // school
+    6, 1, 's', // schools
+    6, 2, 'e', 'd', // schooled
+    // 692
+    0, 7, 'e', 'c', 'o', 'n', 'o', 'm', 'y', // economy
+    6, 3, 'i', 'e', 's', // economies
+    // 693
+    0, 3, 'o', 'c', 'h', // och
+    // 694
+    0, 3, 'a', 't', 't', // att
+    // 695
+    0, 3, 'd', 'e', 't', // det
+    // 696
+    0, 3, 's', 'o', 'm', // som
+    // 697
+    0, 2, 'e', 'n', // en
+    // 698
+    0, 2, 'p', 0xE5, // på
+    // 699
+    0, 2, 0xE4, 'r', // är
+    // 700
+    0, 2, 'a', 'v', // av
+    // 701
+    0, 3, 'f', 0xF6, 'r', // för
+    // 702
+    0, 3, 'm', 'e', 'd', // med
+    // 703
+    0, 4, 't', 'i', 'l', 'l', // till
+    // 704
+    0, 3, 'd', 'e', 'n', // den
+    // 705
+    0, 3, 'h', 'a', 'r', // har
+    // 706
+    0, 2, 'd', 'e', // de
+    // 707
+    0, 4, 'i', 'n', 't', 'e', // inte
+    // 708
+    0, 2, 'o', 'm', // om
+    // 709
+    0, 3, 'e', 't', 't', // ett
+    // 710
+    0, 3, 'h', 'a', 'n', // han
+    // 711
+    0, 3, 'v', 'a', 'r', // var
+    // 712
+    0, 3, 'j', 'a', 'g', // jag
+    // 713
+    0, 3, 's', 'i', 'g', // sig
+    // 714
+    0, 4, 'f', 'r', 0xE5, 'n', // från
+    // 715
+    0, 2, 'v', 'i', // vi
+    // 716
+    0, 2, 's', 0xE5, // så
+    // 717
+    0, 3, 'k', 'a', 'n', // kan
+    // 718
+    0, 3, 'n', 0xE4, 'r', // när
+    // 719
+    0, 2, 0xE5, 'r', // år
+    // 720
+    0, 5, 's', 0xE4, 'g', 'e', 'r', // säger
+    // 721
+    0, 3, 'h', 'o', 'n', // hon
+    // 722
+    0, 5, 'o', 'c', 'k', 's', 0xE5, // också
+    // 723
+    0, 5, 'e', 'f', 't', 'e', 'r', // efter
+    // 724
+    0, 5, 'e', 'l', 'l', 'e', 'r', // eller
+    // 725
+    0, 2, 'n', 'u', // nu
+    // 726
+    0, 3, 's', 'i', 'n', // sin
+    // 727
+    0, 3, 'd', 0xE4, 'r', // där
+    // 728
+    0, 3, 'v', 'i', 'd', // vid
+    // 729
+    0, 3, 'm', 'o', 't', // mot
+    // 730
+    0, 3, 's', 'k', 'a', // ska
+    // 731
+    0, 6, 's', 'k', 'u', 'l', 'l', 'e', // skulle
+    // 732
+    0, 6, 'k', 'o', 'm', 'm', 'e', 'r', // kommer
+    // 733
+    0, 2, 'u', 't', // ut
+    // 734
+    0, 3, 'f', 0xE5, 'r', // får
+    // 735
+    0, 5, 'f', 'i', 'n', 'n', 's', // finns
+    // 736
+    0, 4, 'v', 'a', 'r', 'a', // vara
+    // 737
+    0, 4, 't', 'r', 'o', 'r', // tror
+    // 738
+    0, 4, 'h', 'a', 'd', 'e', // hade
+    // 739
+    0, 4, 'a', 'l', 'l', 'a', // alla
+    // 740
+    0, 5, 'a', 'n', 'd', 'r', 'a', // andra
+    // 741
+    0, 6, 'm', 'y', 'c', 'k', 'e', 't', // mycket
+    // 742
+    0, 2, 0xE4, 'n', // än
+    // 743
+    0, 3, 'h', 0xE4, 'r', // här
+    // 744
+    0, 2, 'd', 0xE5, // då
+    // 745
+    0, 5, 's', 'e', 'd', 'a', 'n', // sedan
+    // 746
+    0, 4, 0xF6, 'v', 'e', 'r', // över
+    // 747
+    0, 4, 'b', 'a', 'r', 'a', // bara
+    // 748
+    0, 4, 'b', 'l', 'i', 'r', // blir
+    // 749
+    0, 3, 'u', 'p', 'p', // upp
+    // 750
+    0, 4, 0xE4, 'v', 'e', 'n', // även
+    // 751
+    0, 3, 'v', 'a', 'd', // vad
+    // 752
+    0, 2, 'f', 0xE5, // få
+    // 753
+    0, 3, 't', 'v', 0xE5, // två
+    // 754
+    0, 4, 'v', 'i', 'l', 'l', // vill
+    // 755
+    0, 2, 'h', 'a', // ha
+    // 756
+    0, 5, 'm', 0xE5, 'n', 'g', 'a', // många
+    // 757
+    0, 3, 'h', 'u', 'r', // hur
+    // 758
+    0, 3, 'm', 'e', 'r', // mer
+    // 759
+    0, 3, 'g', 0xE5, 'r', // går
+    // 760
+    0, 7, 's', 'v', 'e', 'r', 'i', 'g', 'e', // sverige
+    // 761
+    0, 6, 'k', 'r', 'o', 'n', 'o', 'r', // kronor
+    // 762
+    0, 5, 'd', 'e', 't', 't', 'a', // detta
+    // 763
+    0, 3, 'n', 'y', 'a', // nya
+    // 764
+    0, 7, 'p', 'r', 'o', 'c', 'e', 'n', 't', // procent
+    // 765
+    0, 4, 'h', 'a', 'n', 's', // hans
+    // 766
+    0, 4, 'u', 't', 'a', 'n', // utan
+    // 767
+    0, 4, 's', 'i', 'n', 'a', // sina
+    // 768
+    0, 5, 'n', 0xE5, 'g', 'o', 't', // något
+    // 769
+    0, 7, 's', 'v', 'e', 'n', 's', 'k', 'a', // svenska
+    // 770
+    0, 4, 'a', 'l', 'l', 't', // allt
+    // 771
+    0, 6, 'f', 0xF6, 'r', 's', 't', 'a', // första
+    // 772
+    0, 4, 'f', 'i', 'c', 'k', // fick
+    // 773
+    0, 5, 'm', 0xE5, 's', 't', 'e', // måste
+    // 774
+    0, 6, 'm', 'e', 'l', 'l', 'a', 'n', // mellan
+    // 775
+    0, 4, 'b', 'l', 'e', 'v', // blev
+    // 776
+    0, 3, 'b', 'l', 'i', // bli
+    // 777
+    0, 3, 'd', 'a', 'g', // dag
+    // 778
+    0, 5, 'n', 0xE5, 'g', 'o', 'n', // någon
+    // 779
+    0, 5, 'n', 0xE5, 'g', 'r', 'a', // några
+    // 780
+    0, 4, 's', 'i', 't', 't', // sitt
+    // 781
+    0, 4, 's', 't', 'o', 'r', // stor
+    // 782
+    0, 5, 'v', 'a', 'r', 'i', 't', // varit
+    // 783
+    0, 3, 'd', 'e', 'm', // dem
+    // 784
+    0, 5, 'b', 'l', 'a', 'n', 'd', // bland
+    // 785
+    0, 3, 'b', 'r', 'a', // bra
+    // 786
+    0, 3, 't', 'r', 'e', // tre
+    // 787
+    0, 2, 't', 'a', // ta
+    // 788
+    0, 5, 'g', 'e', 'n', 'o', 'm', // genom
+    // 789
+    0, 3, 'd', 'e', 'l', // del
+    // 790
+    0, 4, 'h', 'e', 'l', 'a', // hela
+    // 791
+    0, 5, 'a', 'n', 'n', 'a', 't', // annat
+    // 792
+    0, 4, 'f', 'r', 'a', 'm', // fram
+    // 793
+    0, 3, 'g', 0xF6, 'r', // gör
+    // 794
+    0, 5, 'i', 'n', 'g', 'e', 'n', // ingen
+    // 795
+    0, 9, 's', 't', 'o', 'c', 'k', 'h', 'o', 'l', 'm', // stockholm
+    // 796
+    0, 4, 'g', 0xF6, 'r', 'a', // göra
+    // 797
+    0, 6, 'e', 'n', 'l', 'i', 'g', 't', // enligt
+    // 798
+    0, 3, 'm', 'i', 'g', // mig
+    // 799
+    0, 5, 'r', 'e', 'd', 'a', 'n', // redan
+    // 800
+    0, 4, 'i', 'n', 'o', 'm', // inom
+    // 801
+    0, 3, 'k', 'o', 'm', // kom
+    // 802
+    0, 2, 'd', 'u', // du
+    // 803
+    0, 4, 'h', 'e', 'l', 't', // helt
+    // 804
+    0, 2, 'j', 'u', // ju
+    // 805
+    0, 5, 's', 'a', 'm', 'm', 'a', // samma
+    // 806
+    0, 6, 'k', 'a', 'n', 's', 'k', 'e', // kanske
+    // 807
+    0, 5, 's', 'j', 0xE4, 'l', 'v', // själv
+    // 808
+    0, 3, 'o', 's', 's', // oss
+    // 809
+    0, 8, 't', 'i', 'd', 'i', 'g', 'a', 'r', 'e', // tidigare
+    // 810
+    0, 2, 's', 'e', // se
+    // 811
+    0, 6, 'v', 'e', 'r', 'k', 'a', 'r', // verkar
+    // 812
+    0, 6, 'b', 0xE4, 't', 't', 'r', 'e', // bättre
+    // 813
+    0, 5, 's', 0xE4, 'm', 'r', 'e', // sämre
+    // 814
+    0, 4, 's', 'i', 'd', 'a', // sida
+    // 815
+    0, 3, 'v', 'e', 'm', // vem
+    // 816
+    0, 6, 'v', 'a', 'r', 'f', 0xF6, 'r', // varför
+    // 817
+    0, 2, 'n', 'i', // ni
+    // 818
+    0, 6, 'v', 'i', 'l', 'k', 'e', 'n', // vilken
+    // 819
+    0, 3, 't', 'i', 'd', // tid
+    // 820
+    0, 4, 'l', 'i', 't', 'e', // lite
+    // 821
+    0, 2, 'g', 0xE5, // gå
+};
+
+static const struct cycle_string_list all_cycle_lists[] = {
+    {0, 1, 3}, // 0
+    {5, 3, 2}, // 1
+    {18, 1, 2}, // 2
+    {22, 1, 3}, // 3
+    {27, 2, 1}, // 4
+    {37, 1, 3}, // 5
+    {42, 1, 1}, // 6
+    {45, 1, 2}, // 7
+    {49, 1, 2}, // 8
+    {53, 1, 2}, // 9
+    {57, 1, 2}, // 10
+    {61, 1, 1}, // 11
+    {64, 1, 4}, // 12
+    {70, 1, 2}, // 13
+    {74, 1, 4}, // 14
+    {80, 1, 3}, // 15
+    {85, 1, 4}, // 16
+    {91, 4, 3}, // 17
+    {108, 2, 2}, // 18
+    {115, 2, 4}, // 19
+    {126, 2, 3}, // 20
+    {136, 2, 3}, // 21
+    {146, 1, 6}, // 22
+    {154, 2, 4}, // 23
+    {164, 1, 3}, // 24
+    {169, 4, 1}, // 25
+    {186, 1, 4}, // 26
+    {192, 1, 5}, // 27
+    {199, 1, 3}, // 28
+    {204, 1, 5}, // 29
+    {211, 1, 5}, // 30
+    {218, 3, 2}, // 31
+    {230, 1, 4}, // 32
+    {236, 1, 2}, // 33
+    {240, 1, 2}, // 34
+    {244, 1, 4}, // 35
+    {250, 4, 0}, // 36
+    {269, 1, 3}, // 37
+    {274, 1, 3}, // 38
+    {279, 4, 3}, // 39
+    {297, 1, 7}, // 40
+    {306, 1, 6}, // 41
+    {314, 4, 2}, // 42
+    {331, 1, 2}, // 43
+    {335, 1, 4}, // 44
+    {341, 1, 4}, // 45
+    {347, 4, 0}, // 46
+    {366, 1, 5}, // 47
+    {373, 1, 2}, // 48
+    {377, 1, 2}, // 49
+    {381, 4, 1}, // 50
+    {399, 3, 3}, // 51
+    {412, 2, 3}, // 52
+    {420, 2, 1}, // 53
+    {431, 1, 5}, // 54
+    {438, 1, 2}, // 55
+    {442, 5, 4}, // 56
+    {465, 1, 2}, // 57
+    {469, 3, 1}, // 58
+    {482, 2, 4}, // 59
+    {491, 1, 3}, // 60
+    {496, 1, 3}, // 61
+    {501, 1, 5}, // 62
+    {508, 1, 4}, // 63
+    {514, 1, 2}, // 64
+    {518, 1, 5}, // 65
+    {525, 4, 2}, // 66
+    {543, 1, 4}, // 67
+    {549, 1, 2}, // 68
+    {553, 4, 2}, // 69
+    {575, 2, 4}, // 70
+    {584, 1, 5}, // 71
+    {591, 4, 1}, // 72
+    {608, 1, 3}, // 73
+    {613, 1, 3}, // 74
+    {618, 4, 1}, // 75
+    {637, 1, 6}, // 76
+    {645, 4, 1}, // 77
+    {664, 2, 4}, // 78
+    {673, 2, 2}, // 79
+    {681, 1, 3}, // 80
+    {686, 2, 3}, // 81
+    {696, 1, 4}, // 82
+    {702, 4, 4}, // 83
+    {720, 1, 3}, // 84
+    {725, 1, 4}, // 85
+    {731, 1, 5}, // 86
+    {738, 1, 3}, // 87
+    {743, 4, 4}, // 88
+    {761, 2, 5}, // 89
+    {771, 2, 3}, // 90
+    {779, 1, 4}, // 91
+    {785, 1, 4}, // 92
+    {791, 1, 4}, // 93
+    {797, 1, 4}, // 94
+    {803, 4, 4}, // 95
+    {821, 2, 3}, // 96
+    {829, 1, 4}, // 97
+    {835, 1, 5}, // 98
+    {842, 1, 2}, // 99
+    {846, 2, 5}, // 100
+    {856, 3, 0}, // 101
+    {874, 1, 7}, // 102
+    {883, 1, 4}, // 103
+    {889, 1, 3}, // 104
+    {894, 4, 3}, // 105
+    {911, 4, 1}, // 106
+    {930, 3, 0}, // 107
+    {948, 1, 5}, // 108
+    {955, 2, 1}, // 109
+    {964, 2, 3}, // 110
+    {972, 4, 1}, // 111
+    {992, 4, 1}, // 112
+    {1011, 3, 3}, // 113
+    {1024, 1, 2}, // 114
+    {1028, 1, 3}, // 115
+    {1033, 1, 5}, // 116
+    {1040, 1, 4}, // 117
+    {1046, 4, 4}, // 118
+    {1064, 4, 4}, // 119
+    {1082, 1, 6}, // 120
+    {1090, 1, 4}, // 121
+    {1096, 1, 4}, // 122
+    {1102, 1, 4}, // 123
+    {1108, 1, 6}, // 124
+    {1116, 4, 4}, // 125
+    {1134, 2, 2}, // 126
+    {1145, 1, 3}, // 127
+    {1150, 2, 5}, // 128
+    {1160, 1, 4}, // 129
+    {1166, 4, 2}, // 130
+    {1187, 4, 3}, // 131
+    {1203, 1, 9}, // 132
+    {1214, 1, 3}, // 133
+    {1219, 4, 4}, // 134
+    {1237, 2, 3}, // 135
+    {1248, 1, 3}, // 136
+    {1253, 1, 5}, // 137
+    {1260, 1, 7}, // 138
+    {1269, 4, 4}, // 139
+    {1286, 1, 5}, // 140
+    {1293, 1, 5}, // 141
+    {1300, 2, 5}, // 142
+    {1310, 4, 2}, // 143
+    {1328, 3, 3}, // 144
+    {1340, 3, 5}, // 145
+    {1355, 1, 4}, // 146
+    {1361, 2, 5}, // 147
+    {1373, 1, 2}, // 148
+    {1377, 1, 2}, // 149
+    {1381, 1, 4}, // 150
+    {1387, 4, 3}, // 151
+    {1404, 4, 4}, // 152
+    {1422, 1, 4}, // 153
+    {1428, 4, 4}, // 154
+    {1446, 4, 2}, // 155
+    {1464, 4, 2}, // 156
+    {1483, 4, 3}, // 157
+    {1499, 4, 4}, // 158
+    {1517, 3, 3}, // 159
+    {1531, 1, 5}, // 160
+    {1538, 1, 4}, // 161
+    {1544, 4, 3}, // 162
+    {1561, 1, 5}, // 163
+    {1568, 4, 5}, // 164
+    {1587, 1, 5}, // 165
+    {1594, 3, 4}, // 166
+    {1608, 1, 5}, // 167
+    {1615, 1, 7}, // 168
+    {1624, 4, 3}, // 169
+    {1645, 1, 4}, // 170
+    {1651, 1, 7}, // 171
+    {1660, 4, 6}, // 172
+    {1680, 2, 5}, // 173
+    {1693, 3, 3}, // 174
+    {1706, 1, 3}, // 175
+    {1711, 2, 5}, // 176
+    {1721, 4, 4}, // 177
+    {1739, 1, 5}, // 178
+    {1746, 2, 7}, // 179
+    {1758, 4, 4}, // 180
+    {1776, 1, 5}, // 181
+    {1783, 2, 4}, // 182
+    {1792, 4, 4}, // 183
+    {1809, 2, 2}, // 184
+    {1818, 4, 5}, // 185
+    {1837, 2, 7}, // 186
+    {1849, 4, 7}, // 187
+    {1870, 2, 6}, // 188
+    {1884, 1, 6}, // 189
+    {1892, 2, 4}, // 190
+    {1901, 4, 5}, // 191
+    {1920, 4, 4}, // 192
+    {1938, 1, 3}, // 193
+    {1943, 4, 4}, // 194
+    {1961, 4, 4}, // 195
+    {1979, 3, 3}, // 196
+    {1992, 4, 5}, // 197
+    {2011, 1, 4}, // 198
+    {2017, 2, 4}, // 199
+    {2026, 1, 7}, // 200
+    {2035, 2, 4}, // 201
+    {2044, 1, 6}, // 202
+    {2052, 4, 6}, // 203
+    {2072, 4, 7}, // 204
+    {2093, 2, 6}, // 205
+    {2107, 2, 6}, // 206
+    {2118, 1, 4}, // 207
+    {2124, 4, 7}, // 208
+    {2146, 2, 8}, // 209
+    {2159, 1, 6}, // 210
+    {2167, 5, 5}, // 211
+    {2192, 4, 1}, // 212
+    {2210, 3, 5}, // 213
+    {2225, 2, 6}, // 214
+    {2236, 2, 8}, // 215
+    {2249, 4, 4}, // 216
+    {2267, 2, 5}, // 217
+    {2277, 4, 4}, // 218
+    {2295, 4, 7}, // 219
+    {2316, 4, 1}, // 220
+    {2335, 1, 5}, // 221
+    {2342, 4, 2}, // 222
+    {2364, 1, 4}, // 223
+    {2370, 1, 7}, // 224
+    {2379, 1, 6}, // 225
+    {2387, 3, 5}, // 226
+    {2401, 1, 4}, // 227
+    {2407, 2, 4}, // 228
+    {2416, 1, 5}, // 229
+    {2423, 1, 5}, // 230
+    {2430, 2, 4}, // 231
+    {2439, 4, 2}, // 232
+    {2459, 2, 4}, // 233
+    {2468, 1, 8}, // 234
+    {2478, 1, 5}, // 235
+    {2485, 2, 4}, // 236
+    {2497, 3, 5}, // 237
+    {2512, 2, 5}, // 238
+    {2522, 2, 9}, // 239
+    {2537, 2, 6}, // 240
+    {2549, 2, 9}, // 241
+    {2566, 4, 6}, // 242
+    {2586, 2, 3}, // 243
+    {2594, 4, 4}, // 244
+    {2617, 2, 4}, // 245
+    {2626, 2, 3}, // 246
+    {2634, 2, 4}, // 247
+    {2643, 1, 6}, // 248
+    {2651, 2, 8}, // 249
+    {2665, 2, 5}, // 250
+    {2675, 2, 4}, // 251
+    {2684, 2, 4}, // 252
+    {2693, 1, 4}, // 253
+    {2699, 4, 4}, // 254
+    {2717, 3, 3}, // 255
+    {2732, 4, 5}, // 256
+    {2751, 3, 4}, // 257
+    {2765, 1, 4}, // 258
+    {2771, 3, 1}, // 259
+    {2789, 1, 5}, // 260
+    {2796, 4, 7}, // 261
+    {2817, 2, 7}, // 262
+    {2829, 4, 6}, // 263
+    {2849, 1, 9}, // 264
+    {2860, 2, 6}, // 265
+    {2871, 4, 1}, // 266
+    {2889, 1, 4}, // 267
+    {2895, 1, 5}, // 268
+    {2902, 4, 5}, // 269
+    {2921, 2, 4}, // 270
+    {2930, 2, 4}, // 271
+    {2939, 1, 5}, // 272
+    {2946, 1, 3}, // 273
+    {2951, 4, 4}, // 274
+    {2969, 4, 3}, // 275
+    {2986, 1, 5}, // 276
+    {2993, 1, 4}, // 277
+    {2999, 4, 2}, // 278
+    {3019, 3, 0}, // 279
+    {3034, 4, 3}, // 280
+    {3051, 1, 7}, // 281
+    {3060, 2, 6}, // 282
+    {3071, 4, 2}, // 283
+    {3088, 2, 3}, // 284
+    {3096, 4, 2}, // 285
+    {3113, 2, 3}, // 286
+    {3121, 2, 3}, // 287
+    {3132, 1, 6}, // 288
+    {3140, 4, 7}, // 289
+    {3161, 4, 8}, // 290
+    {3183, 4, 3}, // 291
+    {3199, 1, 5}, // 292
+    {3206, 2, 8}, // 293
+    {3222, 4, 4}, // 294
+    {3240, 1, 4}, // 295
+    {3246, 1, 4}, // 296
+    {3252, 3, 5}, // 297
+    {3266, 1, 5}, // 298
+    {3273, 4, 5}, // 299
+    {3292, 1, 4}, // 300
+    {3298, 4, 6}, // 301
+    {3318, 2, 4}, // 302
+    {3327, 2, 6}, // 303
+    {3338, 1, 7}, // 304
+    {3347, 2, 4}, // 305
+    {3356, 2, 3}, // 306
+    {3364, 2, 3}, // 307
+    {3375, 1, 11}, // 308
+    {3388, 1, 7}, // 309
+    {3397, 1, 3}, // 310
+    {3402, 4, 2}, // 311
+    {3419, 1, 6}, // 312
+    {3427, 4, 7}, // 313
+    {3452, 1, 7}, // 314
+    {3461, 4, 5}, // 315
+    {3481, 1, 8}, // 316
+    {3491, 4, 6}, // 317
+    {3511, 2, 6}, // 318
+    {3522, 4, 4}, // 319
+    {3541, 4, 4}, // 320
+    {3559, 4, 6}, // 321
+    {3579, 1, 6}, // 322
+    {3587, 1, 7}, // 323
+    {3596, 4, 2}, // 324
+    {3616, 4, 4}, // 325
+    {3632, 4, 5}, // 326
+    {3651, 4, 5}, // 327
+    {3670, 4, 3}, // 328
+    {3687, 2, 6}, // 329
+    {3698, 4, 4}, // 330
+    {3716, 1, 4}, // 331
+    {3722, 4, 5}, // 332
+    {3741, 2, 4}, // 333
+    {3750, 1, 6}, // 334
+    {3758, 2, 2}, // 335
+    {3772, 3, 4}, // 336
+    {3785, 2, 6}, // 337
+    {3799, 2, 4}, // 338
+    {3811, 1, 6}, // 339
+    {3819, 4, 2}, // 340
+    {3837, 4, 6}, // 341
+    {3857, 4, 4}, // 342
+    {3875, 2, 7}, // 343
+    {3887, 4, 4}, // 344
+    {3905, 4, 6}, // 345
+    {3925, 3, 3}, // 346
+    {3938, 4, 1}, // 347
+    {3956, 4, 8}, // 348
+    {3979, 2, 4}, // 349
+    {3988, 2, 3}, // 350
+    {3996, 3, 4}, // 351
+    {4012, 2, 4}, // 352
+    {4021, 2, 6}, // 353
+    {4032, 1, 7}, // 354
+    {4041, 4, 3}, // 355
+    {4058, 4, 5}, // 356
+    {4077, 4, 5}, // 357
+    {4096, 1, 6}, // 358
+    {4104, 1, 8}, // 359
+    {4114, 4, 8}, // 360
+    {4136, 2, 6}, // 361
+    {4147, 2, 3}, // 362
+    {4155, 1, 5}, // 363
+    {4162, 1, 6}, // 364
+    {4170, 1, 4}, // 365
+    {4176, 4, 3}, // 366
+    {4193, 1, 10}, // 367
+    {4205, 4, 4}, // 368
+    {4223, 4, 7}, // 369
+    {4245, 2, 5}, // 370
+    {4255, 2, 6}, // 371
+    {4266, 2, 6}, // 372
+    {4277, 1, 4}, // 373
+    {4283, 1, 9}, // 374
+    {4294, 2, 5}, // 375
+    {4304, 4, 4}, // 376
+    {4322, 2, 6}, // 377
+    {4333, 2, 6}, // 378
+    {4344, 2, 8}, // 379
+    {4357, 2, 5}, // 380
+    {4367, 3, 7}, // 381
+    {4383, 3, 6}, // 382
+    {4401, 3, 6}, // 383
+    {4416, 2, 8}, // 384
+    {4429, 3, 6}, // 385
+    {4442, 2, 3}, // 386
+    {4451, 3, 7}, // 387
+    {4468, 2, 3}, // 388
+    {4477, 1, 6}, // 389
+    {4485, 1, 4}, // 390
+    {4491, 1, 6}, // 391
+    {4499, 1, 10}, // 392
+    {4511, 4, 6}, // 393
+    {4534, 4, 4}, // 394
+    {4552, 4, 4}, // 395
+    {4570, 2, 4}, // 396
+    {4579, 2, 5}, // 397
+    {4589, 1, 6}, // 398
+    {4597, 2, 6}, // 399
+    {4608, 4, 4}, // 400
+    {4626, 1, 5}, // 401
+    {4633, 4, 8}, // 402
+    {4655, 4, 6}, // 403
+    {4675, 4, 1}, // 404
+    {4695, 1, 8}, // 405
+    {4705, 2, 5}, // 406
+    {4715, 4, 4}, // 407
+    {4733, 4, 5}, // 408
+    {4752, 4, 6}, // 409
+    {4772, 4, 3}, // 410
+    {4791, 4, 3}, // 411
+    {4808, 4, 6}, // 412
+    {4828, 4, 5}, // 413
+    {4847, 4, 4}, // 414
+    {4865, 4, 4}, // 415
+    {4883, 4, 1}, // 416
+    {4902, 4, 4}, // 417
+    {4921, 4, 3}, // 418
+    {4937, 4, 8}, // 419
+    {4959, 2, 5}, // 420
+    {4969, 4, 6}, // 421
+    {4989, 1, 7}, // 422
+    {4998, 4, 10}, // 423
+    {5022, 1, 6}, // 424
+    {5030, 4, 5}, // 425
+    {5050, 1, 5}, // 426
+    {5057, 4, 4}, // 427
+    {5075, 1, 3}, // 428
+    {5080, 2, 7}, // 429
+    {5091, 2, 8}, // 430
+    {5104, 1, 5}, // 431
+    {5111, 4, 6}, // 432
+    {5131, 4, 6}, // 433
+    {5151, 4, 7}, // 434
+    {5172, 2, 5}, // 435
+    {5183, 4, 7}, // 436
+    {5205, 4, 5}, // 437
+    {5224, 4, 4}, // 438
+    {5242, 1, 7}, // 439
+    {5251, 3, 4}, // 440
+    {5264, 3, 4}, // 441
+    {5278, 2, 5}, // 442
+    {5288, 1, 4}, // 443
+    {5294, 4, 4}, // 444
+    {5313, 1, 6}, // 445
+    {5321, 4, 1}, // 446
+    {5340, 1, 5}, // 447
+    {5347, 1, 9}, // 448
+    {5358, 4, 7}, // 449
+    {5379, 1, 5}, // 450
+    {5386, 6, 7}, // 451
+    {5416, 1, 5}, // 452
+    {5423, 1, 8}, // 453
+    {5433, 1, 8}, // 454
+    {5443, 1, 7}, // 455
+    {5452, 4, 6}, // 456
+    {5473, 4, 5}, // 457
+    {5492, 4, 6}, // 458
+    {5512, 1, 10}, // 459
+    {5524, 4, 6}, // 460
+    {5544, 2, 4}, // 461
+    {5553, 1, 6}, // 462
+    {5561, 1, 8}, // 463
+    {5571, 2, 6}, // 464
+    {5582, 4, 6}, // 465
+    {5602, 4, 4}, // 466
+    {5620, 3, 6}, // 467
+    {5636, 1, 8}, // 468
+    {5646, 2, 6}, // 469
+    {5657, 5, 5}, // 470
+    {5679, 3, 4}, // 471
+    {5693, 4, 5}, // 472
+    {5712, 1, 5}, // 473
+    {5719, 1, 7}, // 474
+    {5728, 4, 4}, // 475
+    {5746, 4, 6}, // 476
+    {5766, 3, 4}, // 477
+    {5779, 4, 5}, // 478
+    {5798, 2, 4}, // 479
+    {5808, 1, 9}, // 480
+    {5819, 2, 8}, // 481
+    {5832, 4, 7}, // 482
+    {5853, 4, 4}, // 483
+    {5871, 4, 4}, // 484
+    {5889, 2, 12}, // 485
+    {5906, 4, 2}, // 486
+    {5926, 4, 3}, // 487
+    {5943, 3, 4}, // 488
+    {5956, 4, 2}, // 489
+    {5976, 2, 10}, // 490
+    {5991, 4, 5}, // 491
+    {6010, 4, 7}, // 492
+    {6031, 4, 5}, // 493
+    {6050, 1, 13}, // 494
+    {6065, 2, 6}, // 495
+    {6076, 3, 4}, // 496
+    {6090, 2, 8}, // 497
+    {6103, 4, 3}, // 498
+    {6121, 4, 6}, // 499
+    {6141, 2, 6}, // 500
+    {6153, 4, 5}, // 501
+    {6172, 2, 6}, // 502
+    {6183, 4, 6}, // 503
+    {6203, 2, 5}, // 504
+    {6214, 2, 8}, // 505
+    {6227, 4, 5}, // 506
+    {6246, 3, 4}, // 507
+    {6260, 1, 5}, // 508
+    {6267, 4, 4}, // 509
+    {6285, 2, 6}, // 510
+    {6296, 4, 8}, // 511
+    {6318, 2, 6}, // 512
+    {6329, 4, 5}, // 513
+    {6347, 1, 10}, // 514
+    {6359, 4, 6}, // 515
+    {6379, 4, 4}, // 516
+    {6397, 4, 1}, // 517
+    {6416, 1, 7}, // 518
+    {6425, 4, 5}, // 519
+    {6444, 4, 6}, // 520
+    {6464, 4, 4}, // 521
+    {6482, 4, 7}, // 522
+    {6503, 2, 5}, // 523
+    {6513, 2, 8}, // 524
+    {6526, 1, 5}, // 525
+    {6533, 4, 6}, // 526
+    {6553, 1, 8}, // 527
+    {6563, 4, 6}, // 528
+    {6583, 4, 4}, // 529
+    {6601, 4, 7}, // 530
+    {6622, 4, 3}, // 531
+    {6638, 4, 4}, // 532
+    {6656, 2, 7}, // 533
+    {6671, 4, 4}, // 534
+    {6690, 4, 5}, // 535
+    {6709, 4, 7}, // 536
+    {6730, 4, 0}, // 537
+    {6748, 4, 1}, // 538
+    {6771, 2, 3}, // 539
+    {6782, 2, 9}, // 540
+    {6796, 3, 3}, // 541
+    {6811, 4, 4}, // 542
+    {6829, 2, 7}, // 543
+    {6844, 2, 6}, // 544
+    {6855, 4, 5}, // 545
+    {6874, 1, 6}, // 546
+    {6882, 4, 5}, // 547
+    {6901, 1, 6}, // 548
+    {6909, 1, 4}, // 549
+    {6915, 4, 5}, // 550
+    {6934, 1, 5}, // 551
+    {6941, 4, 5}, // 552
+    {6960, 4, 8}, // 553
+    {6982, 4, 5}, // 554
+    {7001, 4, 4}, // 555
+    {7019, 2, 6}, // 556
+    {7031, 4, 8}, // 557
+    {7053, 2, 7}, // 558
+    {7065, 2, 4}, // 559
+    {7074, 2, 6}, // 560
+    {7085, 1, 4}, // 561
+    {7091, 4, 4}, // 562
+    {7109, 2, 5}, // 563
+    {7119, 2, 7}, // 564
+    {7132, 1, 5}, // 565
+    {7139, 1, 5}, // 566
+    {7146, 1, 4}, // 567
+    {7152, 4, 6}, // 568
+    {7172, 1, 5}, // 569
+    {7179, 1, 6}, // 570
+    {7187, 1, 7}, // 571
+    {7196, 2, 4}, // 572
+    {7209, 1, 23}, // 573
+    {7234, 1, 7}, // 574
+    {7243, 1, 8}, // 575
+    {7253, 1, 6}, // 576
+    {7261, 1, 5}, // 577
+    {7268, 1, 10}, // 578
+    {7280, 4, 2}, // 579
+    {7302, 4, 4}, // 580
+    {7321, 2, 8}, // 581
+    {7334, 4, 4}, // 582
+    {7352, 1, 9}, // 583
+    {7363, 4, 2}, // 584
+    {7381, 4, 4}, // 585
+    {7399, 2, 4}, // 586
+    {7408, 4, 6}, // 587
+    {7428, 3, 3}, // 588
+    {7442, 1, 6}, // 589
+    {7450, 2, 12}, // 590
+    {7467, 4, 3}, // 591
+    {7487, 4, 5}, // 592
+    {7506, 2, 6}, // 593
+    {7517, 1, 9}, // 594
+    {7528, 4, 6}, // 595
+    {7548, 1, 4}, // 596
+    {7554, 2, 6}, // 597
+    {7565, 2, 7}, // 598
+    {7577, 2, 5}, // 599
+    {7590, 2, 6}, // 600
+    {7601, 2, 6}, // 601
+    {7612, 4, 7}, // 602
+    {7633, 1, 9}, // 603
+    {7644, 1, 6}, // 604
+    {7652, 2, 10}, // 605
+    {7670, 4, 4}, // 606
+    {7688, 3, 5}, // 607
+    {7703, 4, 9}, // 608
+    {7726, 2, 6}, // 609
+    {7737, 1, 6}, // 610
+    {7745, 4, 4}, // 611
+    {7763, 1, 5}, // 612
+    {7770, 4, 5}, // 613
+    {7789, 4, 8}, // 614
+    {7811, 4, 8}, // 615
+    {7833, 2, 10}, // 616
+    {7848, 1, 6}, // 617
+    {7856, 4, 8}, // 618
+    {7878, 1, 3}, // 619
+    {7883, 4, 5}, // 620
+    {7902, 4, 4}, // 621
+    {7920, 1, 7}, // 622
+    {7929, 4, 4}, // 623
+    {7947, 4, 4}, // 624
+    {7964, 2, 11}, // 625
+    {7980, 1, 6}, // 626
+    {7988, 2, 4}, // 627
+    {7997, 4, 7}, // 628
+    {8018, 4, 5}, // 629
+    {8037, 4, 6}, // 630
+    {8057, 3, 5}, // 631
+    {8072, 4, 7}, // 632
+    {8093, 2, 7}, // 633
+    {8108, 4, 4}, // 634
+    {8126, 1, 4}, // 635
+    {8132, 4, 5}, // 636
+    {8151, 4, 5}, // 637
+    {8170, 1, 7}, // 638
+    {8179, 4, 4}, // 639
+    {8197, 2, 8}, // 640
+    {8210, 4, 1}, // 641
+    {8232, 4, 3}, // 642
+    {8251, 4, 3}, // 643
+    {8269, 3, 5}, // 644
+    {8284, 1, 4}, // 645
+    {8290, 1, 14}, // 646
+    {8306, 3, 4}, // 647
+    {8320, 1, 6}, // 648
+    {8328, 4, 4}, // 649
+    {8346, 1, 4}, // 650
+    {8352, 4, 4}, // 651
+    {8370, 4, 9}, // 652
+    {8393, 4, 5}, // 653
+    {8413, 1, 7}, // 654
+    {8422, 4, 4}, // 655
+    {8441, 1, 4}, // 656
+    {8447, 4, 4}, // 657
+    {8465, 4, 5}, // 658
+    {8484, 4, 4}, // 659
+    {8502, 4, 4}, // 660
+    {8521, 2, 5}, // 661
+    {8533, 4, 5}, // 662
+    {8552, 4, 5}, // 663
+    {8571, 4, 4}, // 664
+    {8589, 3, 4}, // 665
+    {8602, 2, 8}, // 666
+    {8615, 4, 4}, // 667
+    {8633, 4, 5}, // 668
+    {8652, 4, 5}, // 669
+    {8671, 3, 4}, // 670
+    {8685, 4, 7}, // 671
+    {8706, 1, 6}, // 672
+    {8714, 4, 4}, // 673
+    {8732, 2, 4}, // 674
+    {8746, 2, 6}, // 675
+    {8757, 2, 7}, // 676
+    {8769, 2, 9}, // 677
+    {8783, 2, 8}, // 678
+    {8796, 2, 6}, // 679
+    {8807, 2, 8}, // 680
+    {8820, 2, 6}, // 681
+    {8831, 4, 4}, // 682
+    {8849, 2, 8}, // 683
+    {8862, 1, 7}, // 684
+    {8871, 4, 3}, // 685
+    {8889, 3, 3}, // 686
+    {8900, 1, 7}, // 687
+    {8909, 2, 6}, // 688
+    {8921, 2, 6}, // 689
+    {8932, 3, 7}, // 690
+    {8948, 3, 6}, // 691
+    {8963, 2, 6}, // 692
+    {8977, 1, 3}, // 693
+    {8982, 1, 3}, // 694
+    {8987, 1, 3}, // 695
+    {8992, 1, 3}, // 696
+    {8997, 1, 2}, // 697
+    {9001, 1, 2}, // 698
+    {9005, 1, 2}, // 699
+    {9009, 1, 2}, // 700
+    {9013, 1, 3}, // 701
+    {9018, 1, 3}, // 702
+    {9023, 1, 4}, // 703
+    {9029, 1, 3}, // 704
+    {9034, 1, 3}, // 705
+    {9039, 1, 2}, // 706
+    {9043, 1, 4}, // 707
+    {9049, 1, 2}, // 708
+    {9053, 1, 3}, // 709
+    {9058, 1, 3}, // 710
+    {9063, 1, 3}, // 711
+    {9068, 1, 3}, // 712
+    {9073, 1, 3}, // 713
+    {9078, 1, 4}, // 714
+    {9084, 1, 2}, // 715
+    {9088, 1, 2}, // 716
+    {9092, 1, 3}, // 717
+    {9097, 1, 3}, // 718
+    {9102, 1, 2}, // 719
+    {9106, 1, 5}, // 720
+    {9113, 1, 3}, // 721
+    {9118, 1, 5}, // 722
+    {9125, 1, 5}, // 723
+    {9132, 1, 5}, // 724
+    {9139, 1, 2}, // 725
+    {9143, 1, 3}, // 726
+    {9148, 1, 3}, // 727
+    {9153, 1, 3}, // 728
+    {9158, 1, 3}, // 729
+    {9163, 1, 3}, // 730
+    {9168, 1, 6}, // 731
+    {9176, 1, 6}, // 732
+    {9184, 1, 2}, // 733
+    {9188, 1, 3}, // 734
+    {9193, 1, 5}, // 735
+    {9200, 1, 4}, // 736
+    {9206, 1, 4}, // 737
+    {9212, 1, 4}, // 738
+    {9218, 1, 4}, // 739
+    {9224, 1, 5}, // 740
+    {9231, 1, 6}, // 741
+    {9239, 1, 2}, // 742
+    {9243, 1, 3}, // 743
+    {9248, 1, 2}, // 744
+    {9252, 1, 5}, // 745
+    {9259, 1, 4}, // 746
+    {9265, 1, 4}, // 747
+    {9271, 1, 4}, // 748
+    {9277, 1, 3}, // 749
+    {9282, 1, 4}, // 750
+    {9288, 1, 3}, // 751
+    {9293, 1, 2}, // 752
+    {9297, 1, 3}, // 753
+    {9302, 1, 4}, // 754
+    {9308, 1, 2}, // 755
+    {9312, 1, 5}, // 756
+    {9319, 1, 3}, // 757
+    {9324, 1, 3}, // 758
+    {9329, 1, 3}, // 759
+    {9334, 1, 7}, // 760
+    {9343, 1, 6}, // 761
+    {9351, 1, 5}, // 762
+    {9358, 1, 3}, // 763
+    {9363, 1, 7}, // 764
+    {9372, 1, 4}, // 765
+    {9378, 1, 4}, // 766
+    {9384, 1, 4}, // 767
+    {9390, 1, 5}, // 768
+    {9397, 1, 7}, // 769
+    {9406, 1, 4}, // 770
+    {9412, 1, 6}, // 771
+    {9420, 1, 4}, // 772
+    {9426, 1, 5}, // 773
+    {9433, 1, 6}, // 774
+    {9441, 1, 4}, // 775
+    {9447, 1, 3}, // 776
+    {9452, 1, 3}, // 777
+    {9457, 1, 5}, // 778
+    {9464, 1, 5}, // 779
+    {9471, 1, 4}, // 780
+    {9477, 1, 4}, // 781
+    {9483, 1, 5}, // 782
+    {9490, 1, 3}, // 783
+    {9495, 1, 5}, // 784
+    {9502, 1, 3}, // 785
+    {9507, 1, 3}, // 786
+    {9512, 1, 2}, // 787
+    {9516, 1, 5}, // 788
+    {9523, 1, 3}, // 789
+    {9528, 1, 4}, // 790
+    {9534, 1, 5}, // 791
+    {9541, 1, 4}, // 792
+    {9547, 1, 3}, // 793
+    {9552, 1, 5}, // 794
+    {9559, 1, 9}, // 795
+    {9570, 1, 4}, // 796
+    {9576, 1, 6}, // 797
+    {9584, 1, 3}, // 798
+    {9589, 1, 5}, // 799
+    {9596, 1, 4}, // 800
+    {9602, 1, 3}, // 801
+    {9607, 1, 2}, // 802
+    {9611, 1, 4}, // 803
+    {9617, 1, 2}, // 804
+    {9621, 1, 5}, // 805
+    {9628, 1, 6}, // 806
+    {9636, 1, 5}, // 807
+    {9643, 1, 3}, // 808
+    {9648, 1, 8}, // 809
+    {9658, 1, 2}, // 810
+    {9662, 1, 6}, // 811
+    {9670, 1, 6}, // 812
+    {9678, 1, 5}, // 813
+    {9685, 1, 4}, // 814
+    {9691, 1, 3}, // 815
+    {9696, 1, 6}, // 816
+    {9704, 1, 2}, // 817
+    {9708, 1, 6}, // 818
+    {9716, 1, 3}, // 819
+    {9721, 1, 4}, // 820
+    {9727, 1, 2}, // 821
+};
+
+static const size_t all_cycle_lists_len = ARRAY_SIZE(all_cycle_lists);
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)
+// First usage counter of each list, plus one past the last list
+static const uint16_t cycle_string_usage_base[] = {
+    0, 0, 3, 3, 3, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 9, 11, 13, 15, 17, 17,
+    19, 19, 23, 23, 23, 23, 23, 23, 26, 26, 26, 26,
+    26, 30, 30, 30, 34, 34, 34, 38, 38, 38, 38, 42,
+    42, 42, 42, 46, 49, 51, 53, 53, 53, 58, 58, 61,
+    63, 63, 63, 63, 63, 63, 63, 67, 67, 67, 71, 73,
+    73, 77, 77, 77, 81, 81, 85, 87, 89, 89, 91, 91,
+    95, 95, 95, 95, 95, 99, 101, 103, 103, 103, 103, 103,
+    107, 109, 109, 109, 109, 111, 114, 114, 114, 114, 118, 122,
+    125, 125, 127, 129, 133, 137, 140, 140, 140, 140, 140, 144,
+    148, 148, 148, 148, 148, 148, 152, 154, 154, 156, 156, 160,
+    164, 164, 164, 168, 170, 170, 170, 170, 174, 174, 174, 176,
+    180, 183, 186, 186, 188, 188, 188, 188, 192, 196, 196, 200,
+    204, 208, 212, 216, 219, 219, 219, 223, 223, 227, 227, 230,
+    230, 230, 234, 234, 234, 238, 240, 243, 243, 245, 249, 249,
+    251, 255, 255, 257, 261, 263, 267, 269, 273, 275, 275, 277,
+    281, 285, 285, 289, 293, 296, 300, 300, 302, 302, 304, 304,
+    308, 312, 314, 316, 316, 320, 322, 322, 327, 331, 334, 336,
+    338, 342, 344, 348, 352, 356, 356, 360, 360, 360, 360, 363,
+    363, 365, 365, 365, 367, 371, 373, 373, 373, 375, 378, 380,
+    382, 384, 386, 390, 392, 396, 398, 400, 402, 402, 404, 406,
+    408, 410, 410, 414, 417, 421, 424, 424, 427, 427, 431, 433,
+    437, 437, 439, 443, 443, 443, 447, 449, 451, 451, 451, 455,
+    459, 459, 459, 463, 466, 470, 470, 472, 476, 478, 482, 484,
+    486, 486, 490, 494, 498, 498, 500, 504, 504, 504, 507, 507,
+    511, 511, 515, 517, 519, 519, 521, 523, 525, 525, 525, 525,
+    529, 529, 533, 533, 537, 537, 541, 543, 547, 551, 555, 555,
+    555, 559, 563, 567, 571, 575, 577, 581, 581, 585, 587, 587,
+    589, 592, 594, 596, 596, 600, 604, 608, 610, 614, 618, 621,
+    625, 629, 631, 633, 636, 638, 640, 640, 644, 648, 652, 652,
+    652, 656, 658, 660, 660, 660, 660, 664, 664, 668, 672, 674,
+    676, 678, 678, 678, 680, 684, 686, 688, 690, 692, 695, 698,
+    701, 703, 706, 708, 711, 713, 713, 713, 713, 713, 717, 721,
+    725, 727, 729, 729, 731, 735, 735, 739, 743, 747, 747, 749,
+    753, 757, 761, 765, 769, 773, 777, 781, 785, 789, 793, 797,
+    801, 803, 807, 807, 811, 811, 815, 815, 819, 819, 821, 823,
+    823, 827, 831, 835, 837, 841, 845, 849, 849, 852, 855, 857,
+    857, 861, 861, 865, 865, 865, 869, 869, 875, 875, 875, 875,
+    875, 879, 883, 887, 887, 891, 893, 893, 893, 895, 899, 903,
+    906, 906, 908, 913, 916, 920, 920, 920, 924, 928, 931, 935,
+    937, 937, 939, 943, 947, 951, 953, 957, 961, 964, 968, 970,
+    974, 978, 982, 982, 984, 987, 989, 993, 997, 999, 1003, 1005,
+    1009, 1011, 1013, 1017, 1020, 1020, 1024, 1026, 1030, 1032, 1036, 1036,
+    1040, 1044, 1048, 1048, 1052, 1056, 1060, 1064, 1066, 1068, 1068, 1072,
+    1072, 1076, 1080, 1084, 1088, 1092, 1094, 1098, 1102, 1106, 1110, 1114,
+    1116, 1118, 1121, 1125, 1127, 1129, 1133, 1133, 1137, 1137, 1137, 1141,
+    1141, 1145, 1149, 1153, 1157, 1159, 1163, 1165, 1167, 1169, 1169, 1173,
+    1175, 1177, 1177, 1177, 1177, 1181, 1181, 1181, 1181, 1183, 1183, 1183,
+    1183, 1183, 1183, 1183, 1187, 1191, 1193, 1197, 1197, 1201, 1205, 1207,
+    1211, 1214, 1214, 1216, 1220, 1224, 1226, 1226, 1230, 1230, 1232, 1234,
+    1236, 1238, 1240, 1244, 1244, 1244, 1246, 1250, 1253, 1257, 1259, 1259,
+    1263, 1263, 1267, 1271, 1275, 1277, 1277, 1281, 1281, 1285, 1289, 1289,
+    1293, 1297, 1299, 1299, 1301, 1305, 1309, 1313, 1316, 1320, 1322, 1326,
+    1326, 1330, 1334, 1334, 1338, 1340, 1344, 1348, 1352, 1355, 1355, 1355,
+    1358, 1358, 1362, 1362, 1366, 1370, 1374, 1374, 1378, 1378, 1382, 1386,
+    1390, 1394, 1396, 1400, 1404, 1408, 1411, 1413, 1417, 1421, 1425, 1428,
+    1432, 1432, 1436, 1438, 1440, 1442, 1444, 1446, 1448, 1450, 1452, 1456,
+    1458, 1458, 1462, 1465, 1465, 1467, 1469, 1472, 1475, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477,
+};
+#endif
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_TABLE_H
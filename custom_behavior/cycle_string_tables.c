@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "cycle_string_tables.h"
+#include "cycle_string_table.h" // Generated by chords/generate_cycle_string_table.py
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_TYPE_STRING) || IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+#include "type_string_table.h" // Generated by chords/generate_zmk_chords.py
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+#include "chord_engine_table.h" // Generated by chords/generate_zmk_chords.py
+#endif
+
+// The generator already refuses lists that overflow the table widths; catch
+// a hand-edited table too.
+BUILD_ASSERT(sizeof(cycle_string_blob) <= UINT16_MAX + 1,
+             "cycle string blob too large for 16-bit list offsets");
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_TYPE_STRING) || IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+BUILD_ASSERT(sizeof(type_string_blob) <= UINT16_MAX + 1,
+             "type string blob too large for 16-bit offsets");
+#endif
+
+const struct cycle_string_tables cycle_string_builtin_tables = {
+    .cycle_blob = cycle_string_blob,
+    .cycle_lists = all_cycle_lists,
+    .cycle_lists_len = ARRAY_SIZE(all_cycle_lists),
+    .crc = CYCLE_STRING_TABLE_CRC,
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)
+    .usage_base = cycle_string_usage_base,
+#endif
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_TYPE_STRING) || IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+    .type_blob = type_string_blob,
+    .type_strings = type_strings,
+    .type_strings_len = ARRAY_SIZE(type_strings),
+#endif
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CHORD_ENGINE)
+    .chord_seeds = chord_engine_seeds,
+    .chord_buckets = ARRAY_SIZE(chord_engine_seeds),
+    .chord_entries = chord_engine_entries,
+    .chord_slots = ARRAY_SIZE(chord_engine_entries),
+    .chord_offsets = chord_engine_candidate_offsets,
+    .chord_positions = CHORD_ENGINE_POSITIONS,
+    .chord_candidates = chord_engine_candidates,
+    .chord_layers = chord_engine_layers,
+    .chord_layers_len = CHORD_ENGINE_LAYERS,
+    .chord_max_keys = CHORD_ENGINE_MAX_KEYS,
+#endif
+};
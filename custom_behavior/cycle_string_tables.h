@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_TABLES_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_TABLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include "chord_engine_dict.h"
+#include "chord_engine_limits.h" // Generated by chords/generate_zmk_chords.py
+#include "cycle_string_dict.h"
+#include "cycle_string_limits.h" // Generated by chords/generate_cycle_string_table.py
+
+// The generated tables the behaviors type from: the ones compiled in from
+// cycle_string_table.h, type_string_table.h and chord_engine_table.h, or with
+// CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT a dictionary uploaded to its
+// flash partition and read where it lies. Tables of a feature that is off
+// are empty.
+struct cycle_string_tables {
+  const uint8_t *cycle_blob;
+  const struct cycle_string_list *cycle_lists;
+  const uint16_t *usage_base; // First usage counter of each list, plus one past the last
+  const uint8_t *type_blob;
+  const struct cycle_string_list *type_strings;
+  const uint16_t *chord_seeds;
+  const struct chord_engine_entry *chord_entries;
+  const uint16_t *chord_offsets; // Candidate index rows, chord_positions per layer plus one
+  const uint16_t *chord_candidates;
+  const struct chord_engine_layer *chord_layers;
+  uint32_t crc; // Of the cycle lists, as CYCLE_STRING_TABLE_CRC
+  uint16_t cycle_lists_len;
+  uint16_t type_strings_len;
+  uint16_t chord_buckets;
+  uint16_t chord_slots;
+  uint16_t chord_positions;
+  uint8_t chord_layers_len;
+  uint8_t chord_max_keys;
+};
+
+extern const struct cycle_string_tables cycle_string_builtin_tables;
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT)
+
+// The uploaded dictionary when the partition holds a valid one
+const struct cycle_string_tables *cycle_string_tables_get(void);
+
+// Room a sequence or chord needs, for any dictionary that may be uploaded
+#define CYCLE_STRING_VARIANTS_CAPACITY                                                             \
+  MAX(CYCLE_STRING_MAX_VARIANTS, CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT_MAX_VARIANTS)
+#define CHORD_ENGINE_KEYS_CAPACITY                                                                 \
+  MAX(CHORD_ENGINE_MAX_KEYS, CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT_MAX_CHORD_KEYS)
+
+#else
+
+static inline const struct cycle_string_tables *cycle_string_tables_get(void) {
+  return &cycle_string_builtin_tables;
+}
+
+#define CYCLE_STRING_VARIANTS_CAPACITY CYCLE_STRING_MAX_VARIANTS
+#define CHORD_ENGINE_KEYS_CAPACITY CHORD_ENGINE_MAX_KEYS
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_FLASH_DICT)
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_TABLES_H
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/atomic.h>
+
+#include "cycle_string_trace.h"
+
+// Bucket n counts spans of [2^n, 2^(n+1)) microseconds, bucket 0 everything
+// under 2 us and the last one everything from 2^15 us (about 33 ms) up
+#define TRACE_BUCKETS 16
+
+static const char *const span_names[CYCLE_STRING_TRACE_SPANS] = {
+    [CYCLE_STRING_TRACE_PRESS] = "press",
+    [CYCLE_STRING_TRACE_BACKSPACES] = "backspaces",
+    [CYCLE_STRING_TRACE_STRING] = "string",
+    [CYCLE_STRING_TRACE_CAPTURE] = "capture",
+};
+
+// Spans end on the work queue thread with CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ASYNC
+// and in event context otherwise, so counts are atomic
+static atomic_t histogram[CYCLE_STRING_TRACE_SPANS][TRACE_BUCKETS];
+
+void cycle_string_trace_record(enum cycle_string_trace_span span, uint32_t start) {
+  uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+  uint8_t bucket = us < 2 ? 0 : MIN(31 - __builtin_clz(us), TRACE_BUCKETS - 1);
+  atomic_inc(&histogram[span][bucket]);
+}
+
+// One CSV line per non-empty bucket: span, bucket lower bound in
+// microseconds, count
+static int cmd_trace(const struct shell *sh, size_t argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+    for (int span = 0; span < CYCLE_STRING_TRACE_SPANS; ++span) {
+      for (int bucket = 0; bucket < TRACE_BUCKETS; ++bucket) {
+        atomic_clear(&histogram[span][bucket]);
+      }
+    }
+    shell_print(sh, "Cycle string trace cleared");
+    return 0;
+  }
+  shell_print(sh, "span,min_us,count");
+  for (int span = 0; span < CYCLE_STRING_TRACE_SPANS; ++span) {
+    for (int bucket = 0; bucket < TRACE_BUCKETS; ++bucket) {
+      atomic_val_t count = atomic_get(&histogram[span][bucket]);
+      if (count != 0) {
+        shell_print(sh, "%s,%u,%d", span_names[span], bucket == 0 ? 0U : (unsigned)BIT(bucket),
+                    (int)count);
+      }
+    }
+  }
+  return 0;
+}
+
+SHELL_SUBCMD_ADD((cycle_str), trace, NULL,
+                 "Print press-to-report latency histograms as CSV (\"reset\" clears them)",
+                 cmd_trace, 1, 1);
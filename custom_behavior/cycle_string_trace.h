@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_TRACE_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_TRACE_H
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+// Trace probes on the cycle string hot paths. Each span is timed from a
+// start probe, in hardware cycles, into a log2 histogram in RAM that the
+// "cycle_str trace" shell command prints. With
+// CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_TRACE off the probes compile to nothing.
+enum cycle_string_trace_span {
+  CYCLE_STRING_TRACE_PRESS,      // Press handler entry to return
+  CYCLE_STRING_TRACE_BACKSPACES, // Burst queued to its backspaces sent
+  CYCLE_STRING_TRACE_STRING,     // Burst queued to its string typed
+  CYCLE_STRING_TRACE_CAPTURE,    // Listener entry to a punctuation capture
+  CYCLE_STRING_TRACE_SPANS,
+};
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_TRACE)
+
+void cycle_string_trace_record(enum cycle_string_trace_span span, uint32_t start);
+
+// Declare a start timestamp
+#define CYCLE_STRING_TRACE_START(start) uint32_t start = k_cycle_get_32()
+// Record a span that began at a start timestamp
+#define CYCLE_STRING_TRACE_END(span, start) cycle_string_trace_record(span, start)
+// Carry a start timestamp into a burst, for spans that end in the emitter
+#define CYCLE_STRING_TRACE_SET(field, start) ((field) = (start))
+
+#else
+
+#define CYCLE_STRING_TRACE_START(start)
+#define CYCLE_STRING_TRACE_END(span, start)
+#define CYCLE_STRING_TRACE_SET(field, start)
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_TRACE)
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_TRACE_H
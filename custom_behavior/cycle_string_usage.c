@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "cycle_string_tables.h"
+#include "cycle_string_usage.h"
+
+// One use count per variant of every list with more than one, located
+// through the usage base of the tables in use. A count that would overflow
+// halves the whole list instead, so old habits fade and a new favorite takes
+// over.
+static uint8_t usage_counts[CYCLE_STRING_USAGE_SLOTS];
+
+// Lists with counters: room is made for the built-in table, so lists an
+// uploaded dictionary has past that keep table order
+#define USAGE_LISTS CYCLE_STRING_LISTS
+
+static inline size_t counted_lists(const struct cycle_string_tables *tables) {
+  return MIN(tables->cycle_lists_len, USAGE_LISTS);
+}
+
+// Slots of a list's counters, or 0 if it has none or they do not fit
+static inline uint16_t usage_len(const struct cycle_string_tables *tables, uint32_t list_index) {
+  if (list_index >= counted_lists(tables) ||
+      tables->usage_base[list_index + 1] > CYCLE_STRING_USAGE_SLOTS) {
+    return 0;
+  }
+  return tables->usage_base[list_index + 1] - tables->usage_base[list_index];
+}
+
+void cycle_string_usage_order(uint32_t list_index, uint8_t len, uint8_t *order) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  bool counted = usage_len(tables, list_index) == len;
+  const uint8_t *counts = counted ? &usage_counts[tables->usage_base[list_index]] : NULL;
+  // Insertion sort: lists are a handful of variants, and it keeps equal
+  // counts in table order
+  for (uint8_t i = 0; i < len; ++i) {
+    uint8_t j = i;
+    for (; j > 0 && counted && counts[order[j - 1]] < counts[i]; --j) {
+      order[j] = order[j - 1];
+    }
+    order[j] = i;
+  }
+}
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+
+// Lists whose counts changed since the last save
+static ATOMIC_DEFINE(dirty_lists, USAGE_LISTS);
+// Lists with counts in settings, loaded at boot or saved since
+static ATOMIC_DEFINE(stored_lists, USAGE_LISTS);
+// Saved counts are only valid for the table they were counted against
+static uint32_t saved_table_crc;
+
+// Write every changed list under cycle_str/<list>. Runs once typing has been
+// idle for CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE, so a whole session of cycling
+// costs one batch of small writes rather than one per word.
+static void usage_save_work_handler(struct k_work *work) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  if (tables->cycle_lists_len == 0) {
+    return; // A dictionary upload is in progress, saved once it is loaded
+  }
+  if (saved_table_crc != tables->crc) {
+    uint32_t crc = tables->crc;
+    int err = settings_save_one("cycle_str/crc", &crc, sizeof(crc));
+    if (err < 0) {
+      LOG_ERR("Failed to save cycle string table checksum (%d)", err);
+      return;
+    }
+    saved_table_crc = crc;
+  }
+  for (size_t i = 0; i < counted_lists(tables); ++i) {
+    if (!atomic_test_and_clear_bit(dirty_lists, i)) {
+      continue;
+    }
+    char name[sizeof("cycle_str/65535")];
+    snprintf(name, sizeof(name), "cycle_str/%u", (unsigned)i);
+    int err = settings_save_one(name, &usage_counts[tables->usage_base[i]], usage_len(tables, i));
+    if (err < 0) {
+      LOG_ERR("Failed to save cycle string usage for list %u (%d)", (unsigned)i, err);
+      continue;
+    }
+    atomic_set_bit(stored_lists, i);
+  }
+}
+
+static K_WORK_DELAYABLE_DEFINE(usage_save_work, usage_save_work_handler);
+
+static int usage_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                              void *cb_arg) {
+  const char *next;
+  if (settings_name_steq(name, "crc", &next) && !next) {
+    if (len != sizeof(saved_table_crc)) {
+      return -EINVAL;
+    }
+    int err = read_cb(cb_arg, &saved_table_crc, sizeof(saved_table_crc));
+    return MIN(err, 0);
+  }
+
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  char *end;
+  unsigned long list_index = strtoul(name, &end, 10);
+  if (end == name || *end != '\0' || list_index >= counted_lists(tables)) {
+    return -ENOENT;
+  }
+  // Marked dirty until the commit below knows the counts are still valid
+  atomic_set_bit(dirty_lists, list_index);
+  atomic_set_bit(stored_lists, list_index);
+  size_t count = usage_len(tables, list_index);
+  if (len != count) {
+    return 0; // The list gained or lost variants, start it over
+  }
+  int err = read_cb(cb_arg, &usage_counts[tables->usage_base[list_index]], count);
+  return MIN(err, 0);
+}
+
+static int usage_settings_commit(void) {
+  if (saved_table_crc == cycle_string_tables_get()->crc) {
+    for (size_t i = 0; i < USAGE_LISTS; ++i) {
+      atomic_clear_bit(dirty_lists, i);
+    }
+    return 0;
+  }
+  // The lists were regenerated since the counts were saved and they may
+  // belong to other words now. Start over and overwrite what was saved.
+  LOG_INF("Cycle string table changed, resetting usage counts");
+  cycle_string_usage_reset();
+  return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(cycle_string_usage, "cycle_str", NULL, usage_settings_set,
+                               usage_settings_commit, NULL);
+
+#endif // IS_ENABLED(CONFIG_SETTINGS)
+
+void cycle_string_usage_reset(void) {
+  memset(usage_counts, 0, sizeof(usage_counts));
+#if IS_ENABLED(CONFIG_SETTINGS)
+  // Overwrite whatever was saved, so no list inherits another's counts
+  for (size_t i = 0; i < USAGE_LISTS; ++i) {
+    if (atomic_test_bit(stored_lists, i)) {
+      atomic_set_bit(dirty_lists, i);
+    }
+  }
+  k_work_reschedule(&usage_save_work, K_MSEC(CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE));
+#endif
+}
+
+void cycle_string_usage_record(uint32_t list_index, uint8_t variant) {
+  const struct cycle_string_tables *tables = cycle_string_tables_get();
+  uint16_t len = usage_len(tables, list_index);
+  if (variant >= len) {
+    return; // Single-variant lists have nothing to reorder
+  }
+  uint8_t *counts = &usage_counts[tables->usage_base[list_index]];
+  if (counts[variant] == UINT8_MAX) {
+    for (uint16_t i = 0; i < len; ++i) {
+      counts[i] /= 2;
+    }
+  }
+  ++counts[variant];
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+  atomic_set_bit(dirty_lists, list_index);
+  k_work_reschedule(&usage_save_work, K_MSEC(CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE));
+#endif
+}
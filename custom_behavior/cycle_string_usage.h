@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CUSTOM_BEHAVIOR_CYCLE_STRING_USAGE_H
+#define CUSTOM_BEHAVIOR_CYCLE_STRING_USAGE_H
+
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#if IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)
+
+// Fill order with the variants of a list (len of them) in the order a new
+// cycle sequence steps through them: most used first, ties in table order
+void cycle_string_usage_order(uint32_t list_index, uint8_t len, uint8_t *order);
+
+// Count one use of a variant: the one a cycle sequence ended on
+void cycle_string_usage_record(uint32_t list_index, uint8_t variant);
+
+// Forget all counts, saved ones included: the lists they were counted for
+// are gone
+void cycle_string_usage_reset(void);
+
+#else
+
+static inline void cycle_string_usage_order(uint32_t list_index, uint8_t len,
+                                            uint8_t *order) {
+  for (uint8_t i = 0; i < len; ++i) {
+    order[i] = i;
+  }
+}
+
+static inline void cycle_string_usage_record(uint32_t list_index, uint8_t variant) {}
+
+static inline void cycle_string_usage_reset(void) {}
+
+#endif // IS_ENABLED(CONFIG_ZMK_BEHAVIOR_CYCLE_STRING_ADAPTIVE)
+
+#endif // CUSTOM_BEHAVIOR_CYCLE_STRING_USAGE_H
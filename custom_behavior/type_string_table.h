@@ -0,0 +1,35 @@
+/*
+ * Generated from jocke_chords.json by chords/generate_zmk_chords.py
+ * DO NOT EDIT MANUALLY
+ *
+ * Strings typed by the type string behavior, each a single-variant list in
+ * the cycle list format, see cycle_string_dict.h.
+ */
+
+#ifndef CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H
+#define CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#include "cycle_string_dict.h"
+
+static const uint8_t type_string_blob[] = {
+    0, 5, 'w', 'h', 'e', 'n', ' ', // 0: when
+    0, 4, 'c', 'a', 'n', ' ', // 1: can
+    0, 5, 'm', 'o', 'r', 'e', ' ', // 2: more
+    0, 3, 'i', 'f', ' ', // 3: if
+};
+
+static const struct cycle_string_list type_strings[] = {
+    {0, 1, 5}, // 0
+    {7, 1, 4}, // 1
+    {13, 1, 5}, // 2
+    {20, 1, 3}, // 3
+};
+
+static const size_t type_strings_len = ARRAY_SIZE(type_strings);
+
+#endif // CUSTOM_BEHAVIOR_TYPE_STRING_TABLE_H